@@ -0,0 +1,83 @@
+#pragma once
+
+/// @file bench.hpp
+/// @brief Timing and reporting helpers shared by the bench/ programs.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace bench {
+
+using Clock = std::chrono::steady_clock;
+
+inline double SecondsSince(Clock::time_point start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+inline uint32_t NanosSince(Clock::time_point start)
+{
+  auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+  return ns > INT32_MAX ? INT32_MAX : static_cast<uint32_t>(ns);
+}
+
+inline const char* BackendName()
+{
+#if defined(OSAL_BACKEND_POSIX) && defined(OSAL_POSIX_FUTEX)
+  return "posix+futex";
+#elif defined(OSAL_BACKEND_POSIX)
+  return "posix";
+#else
+  return "cppstd";
+#endif
+}
+
+/// Scenario title plus what it ran on, since most results scale with cores.
+inline void Header(const char* title)
+{
+  std::printf("== %s [%s, %u cpus]\n", title, BackendName(),
+              std::thread::hardware_concurrency());
+}
+
+/// Marks a row whose threads outnumber the host's cpus. Such rows
+/// time-slice on shared cores, so they measure no cross-core contention.
+inline const char* Oversubscribed(uint32_t threads)
+{
+  return threads > std::thread::hardware_concurrency() ? "*" : " ";
+}
+
+/// Footnote for tables that use Oversubscribed().
+inline void OversubscribedNote()
+{
+  std::printf("  * more threads than cpus: time-sliced, no cross-core contention\n");
+}
+
+/// Starts and joins a throwaway thread. Single-threaded scenarios call it
+/// first so libc's lock shortcuts for single-threaded processes, which no
+/// real user of these primitives gets, do not flatter the numbers.
+inline void LeaveSingleThreaded()
+{
+  std::thread([] {}).join();
+}
+
+/// `ops` completed in `seconds`, as millions per second.
+inline void Rate(const char* label, uint64_t ops, double seconds)
+{
+  std::printf("  %-40s %9.2f M/s\n", label, double(ops) / seconds / 1e6);
+}
+
+/// Percentiles of per-operation latencies in nanoseconds (sorts `ns`).
+inline void Latency(const char* label, std::vector<uint32_t>& ns)
+{
+  if (ns.empty()) return;
+  std::sort(ns.begin(), ns.end());
+  auto at = [&](double q) { return ns[std::min(ns.size() - 1, size_t(q * double(ns.size())))] / 1e3; };
+  std::printf("  %-40s p50 %8.2f  p99 %8.2f  p99.9 %8.2f  max %9.2f us\n",
+              label, at(0.50), at(0.99), at(0.999), ns.back() / 1e3);
+}
+
+} // namespace bench
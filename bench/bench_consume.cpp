@@ -0,0 +1,55 @@
+// Batch consumption: one producer feeds a MessageQueue with PutMany and the
+// consumer drains it with a Get loop, with GetMany, or with Consume, which
+// takes the lock once per batch instead of once per message.
+
+#include "bench.hpp"
+#include "osal/osal.hpp"
+#include <algorithm>
+
+using namespace ifce::os;
+
+namespace {
+
+constexpr uint32_t kCapacity = 1024;
+constexpr uint32_t kBatch    = 256;
+constexpr uint64_t kMessages = 5'000'000;
+
+template <typename Drain>
+void Run(const char* label, Drain&& drain)
+{
+  MessageQueue<uint64_t> q;
+  q.Create(kCapacity);
+  auto start = bench::Clock::now();
+  std::thread producer([&] {
+    uint64_t batch[kBatch] = {};
+    for (uint64_t sent = 0; sent < kMessages;)
+      sent += q.PutMany(batch, uint32_t(std::min<uint64_t>(kBatch, kMessages - sent)));
+  });
+  uint64_t sum = 0;
+  for (uint64_t got = 0; got < kMessages;) got += drain(q, sum);
+  producer.join();
+  bench::Rate(label, kMessages, bench::SecondsSince(start));
+}
+
+} // namespace
+
+int main()
+{
+  bench::Header("Consume: draining a batch-fed MessageQueue");
+  Run("Get loop", [](auto& q, uint64_t& sum) -> uint64_t {
+    uint64_t v = 0;
+    q.Get(v);
+    sum += v;
+    return 1;
+  });
+  Run("GetMany", [](auto& q, uint64_t& sum) -> uint64_t {
+    uint64_t batch[kBatch];
+    uint32_t n = q.GetMany(batch, kBatch);
+    for (uint32_t i = 0; i < n; ++i) sum += batch[i];
+    return n;
+  });
+  Run("Consume", [](auto& q, uint64_t& sum) -> uint64_t {
+    return q.Consume([&](uint64_t& v) { sum += v; });
+  });
+  return 0;
+}
@@ -0,0 +1,60 @@
+// Mailbox reader throughput while writers overwrite as fast as they can.
+// Every sample carries its sequence number in all words, so a torn read
+// (which the seqlock must prevent) would show up in the last column.
+
+#include "bench.hpp"
+#include "osal/osal.hpp"
+#include <atomic>
+#include <cstdio>
+
+using namespace ifce::os;
+
+namespace {
+
+struct State { uint64_t words[8]; };
+
+constexpr uint64_t kPeeks = 5'000'000;
+
+void Run(uint32_t writers)
+{
+  Mailbox<State> box;
+  box.Create();
+  box.Overwrite(State{});
+  std::atomic<bool>     stop {false};
+  std::atomic<uint64_t> writes {0};
+  std::vector<std::thread> threads;
+  for (uint32_t w = 0; w < writers; ++w)
+    threads.emplace_back([&] {
+      State s{};
+      uint64_t n = 0;
+      while (!stop.load(std::memory_order_relaxed)) {
+        ++n;
+        for (auto& word : s.words) word = n;
+        box.Overwrite(s);
+      }
+      writes.fetch_add(n, std::memory_order_relaxed);
+    });
+
+  State s{};
+  uint64_t torn = 0;
+  auto start = bench::Clock::now();
+  for (uint64_t i = 0; i < kPeeks; ++i) {
+    box.Peek(s, 0);
+    for (auto word : s.words) torn += word != s.words[0];
+  }
+  double secs = bench::SecondsSince(start);
+  stop = true;
+  for (auto& t : threads) t.join();
+  std::printf("  %-10u %12.2f %14.2f %8llu\n", writers, kPeeks / secs / 1e6,
+              writes.load() / secs / 1e6, static_cast<unsigned long long>(torn));
+}
+
+} // namespace
+
+int main()
+{
+  bench::Header("Mailbox: Peek throughput under unthrottled writers");
+  std::printf("  %-10s %12s %14s %8s\n", "writers", "Peek M/s", "Overwrite M/s", "torn");
+  for (uint32_t writers : {0u, 1u, 2u}) Run(writers);
+  return 0;
+}
@@ -0,0 +1,63 @@
+// Fan-in scaling: 1 to 16 producers feeding one consumer, the mutex
+// MessageQueue against the Vyukov MpmcMessageQueue. The message total is
+// fixed, so a flat row means throughput does not collapse with producers.
+// The balanced table adds as many consumers as producers, so both cursors
+// are contended. Starred rows ran more threads than the host has cpus.
+
+#include "bench.hpp"
+#include "osal/osal.hpp"
+#include <cstdio>
+
+using namespace ifce::os;
+
+namespace {
+
+constexpr uint32_t kCapacity = 1024;
+constexpr uint64_t kMessages = 2'000'000;
+
+/// `producers` threads Put kMessages in total while `consumers` threads Get
+/// them, each side splitting the total evenly.
+template <typename Queue>
+double Run(uint32_t producers, uint32_t consumers)
+{
+  Queue q;
+  q.Create(kCapacity);
+  auto start = bench::Clock::now();
+  std::vector<std::thread> threads;
+  for (uint32_t p = 0; p < producers; ++p)
+    threads.emplace_back([&] {
+      for (uint64_t i = 0; i < kMessages / producers; ++i) q.Put(i);
+    });
+  for (uint32_t c = 0; c < consumers; ++c)
+    threads.emplace_back([&] {
+      uint64_t v = 0;
+      for (uint64_t i = 0; i < kMessages / consumers; ++i) q.Get(v);
+    });
+  for (auto& t : threads) t.join();
+  return double(kMessages) / bench::SecondsSince(start) / 1e6;
+}
+
+} // namespace
+
+int main()
+{
+  bench::Header("MPMC fan-in: producers -> 1 consumer (M msg/s)");
+  std::printf("  %-10s %14s %18s\n", "producers", "MessageQueue", "MpmcMessageQueue");
+  for (uint32_t producers : {1u, 2u, 4u, 8u, 16u}) {
+    double mutex = Run<MessageQueue<uint64_t>>(producers, 1);
+    double mpmc  = Run<MpmcMessageQueue<uint64_t>>(producers, 1);
+    std::printf("  %-2u%-8s %14.2f %18.2f\n", producers, bench::Oversubscribed(producers + 1),
+                mutex, mpmc);
+  }
+  bench::OversubscribedNote();
+
+  bench::Header("MPMC balanced: N producers -> N consumers (M msg/s)");
+  std::printf("  %-10s %14s %18s\n", "N", "MessageQueue", "MpmcMessageQueue");
+  for (uint32_t n : {1u, 2u, 4u, 8u}) {
+    double mutex = Run<MessageQueue<uint64_t>>(n, n);
+    double mpmc  = Run<MpmcMessageQueue<uint64_t>>(n, n);
+    std::printf("  %-2u%-8s %14.2f %18.2f\n", n, bench::Oversubscribed(2 * n), mutex, mpmc);
+  }
+  bench::OversubscribedNote();
+  return 0;
+}
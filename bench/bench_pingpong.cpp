@@ -0,0 +1,61 @@
+// Ping-pong handoff latency through the blocking primitives: two threads
+// bounce a token kRoundTrips times and each sample is half a round trip.
+// Build once plain and once with -DOSAL_POSIX_FUTEX=ON to compare the
+// pthread and futex paths.
+
+#include "bench.hpp"
+#include "osal/osal.hpp"
+
+using namespace ifce::os;
+
+namespace {
+
+constexpr uint32_t kRoundTrips = 50'000;
+
+/// `ping()` wakes the echo thread, `pong()` waits for its answer; the echo
+/// thread runs `echo()` once per round trip.
+template <typename Ping, typename Echo>
+void Run(const char* label, Ping&& ping, Echo&& echo)
+{
+  std::thread peer([&] {
+    for (uint32_t i = 0; i < kRoundTrips; ++i) echo();
+  });
+  std::vector<uint32_t> ns;
+  ns.reserve(kRoundTrips);
+  for (uint32_t i = 0; i < kRoundTrips; ++i) {
+    auto start = bench::Clock::now();
+    ping();
+    ns.push_back(bench::NanosSince(start) / 2);
+  }
+  peer.join();
+  bench::Latency(label, ns);
+}
+
+} // namespace
+
+int main()
+{
+  bench::Header("Ping-pong: one-way handoff latency");
+
+  Semaphore a, b;
+  a.Create(1, 0);
+  b.Create(1, 0);
+  Run("Semaphore",
+      [&] { a.Release(); b.Acquire(); },
+      [&] { a.Acquire(); b.Release(); });
+
+  EventFlags flags;
+  flags.Create();
+  constexpr uint32_t kPing = 1u << 0, kPong = 1u << 1;
+  Run("EventFlags",
+      [&] { flags.Set(kPing); flags.Wait(kPong, false, true, WaitForever); },
+      [&] { flags.Wait(kPing, false, true, WaitForever); flags.Set(kPong); });
+
+  MessageQueue<uint32_t> to, from;
+  to.Create(1);
+  from.Create(1);
+  Run("MessageQueue",
+      [&] { uint32_t v = 0; to.Put(v); from.Get(v); },
+      [&] { uint32_t v = 0; to.Get(v); from.Put(v); });
+  return 0;
+}
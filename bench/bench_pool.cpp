@@ -0,0 +1,49 @@
+// MemoryPool alloc/free pairs from 1 to 32 threads sharing one pool, the
+// mutex free list against PoolSync::LockFree. The pair total is fixed, so
+// the rows compare aggregate throughput as threads are added. Only rows
+// with no more threads than cpus say anything about contention.
+
+#include "bench.hpp"
+#include "osal/osal.hpp"
+#include <cstdio>
+
+using namespace ifce::os;
+
+namespace {
+
+struct Block { uint64_t words[8]; };
+
+constexpr uint32_t kBlocks = 1024;
+constexpr uint64_t kPairs  = 4'000'000;
+
+double Run(PoolSync sync, uint32_t threads)
+{
+  MemoryPool<Block> pool;
+  pool.Create(kBlocks, sync);
+  uint64_t per = kPairs / threads;
+  auto start = bench::Clock::now();
+  std::vector<std::thread> workers;
+  for (uint32_t t = 0; t < threads; ++t)
+    workers.emplace_back([&] {
+      for (uint64_t i = 0; i < per; ++i) {
+        Block* b = pool.Alloc(WaitForever);
+        b->words[0] = i;
+        pool.Free(b);
+      }
+    });
+  for (auto& w : workers) w.join();
+  return double(per * threads) / bench::SecondsSince(start) / 1e6;
+}
+
+} // namespace
+
+int main()
+{
+  bench::Header("MemoryPool: alloc/free pairs (M pairs/s)");
+  std::printf("  %-10s %10s %12s\n", "threads", "mutex", "lock-free");
+  for (uint32_t threads : {1u, 2u, 4u, 8u, 16u, 32u})
+    std::printf("  %-2u%-8s %10.2f %12.2f\n", threads, bench::Oversubscribed(threads),
+                Run(PoolSync::Mutex, threads), Run(PoolSync::LockFree, threads));
+  bench::OversubscribedNote();
+  return 0;
+}
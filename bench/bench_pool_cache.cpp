@@ -0,0 +1,82 @@
+// PoolCache in front of MemoryPool. "pairs" allocates and frees on one
+// thread; "remote free" allocates on a producer and frees on a consumer
+// that receives the blocks through an SpscMessageQueue, the pattern the
+// magazines hand back to the pool M blocks at a time.
+
+#include "bench.hpp"
+#include "osal/osal.hpp"
+
+using namespace ifce::os;
+
+namespace {
+
+struct Block { uint64_t words[8]; };
+
+constexpr uint32_t kBlocks = 4096;
+constexpr uint64_t kPairs  = 10'000'000;
+constexpr uint64_t kRemote = 2'000'000;
+
+using Cache = PoolCache<Block, 32>;
+
+template <typename AllocFn, typename FreeFn>
+void Pairs(const char* label, AllocFn&& alloc, FreeFn&& free)
+{
+  auto start = bench::Clock::now();
+  for (uint64_t i = 0; i < kPairs; ++i) {
+    Block* b = alloc();
+    b->words[0] = i;
+    free(b);
+  }
+  bench::Rate(label, kPairs, bench::SecondsSince(start));
+}
+
+void RemoteFree(const char* label, PoolSync sync, bool cached)
+{
+  MemoryPool<Block> pool;
+  pool.Create(kBlocks, sync);
+  SpscMessageQueue<Block*> pipe;
+  pipe.Create(1024);
+  auto start = bench::Clock::now();
+  std::thread consumer([&] {
+    Cache cache(pool);
+    Block* b = nullptr;
+    for (uint64_t i = 0; i < kRemote; ++i) {
+      pipe.Get(b);
+      if (cached) cache.Free(b);
+      else        pool.Free(b);
+    }
+  });
+  {
+    Cache cache(pool);
+    for (uint64_t i = 0; i < kRemote; ++i) {
+      Block* b = cached ? cache.Alloc(WaitForever) : pool.Alloc(WaitForever);
+      pipe.Put(b);
+    }
+    consumer.join();
+  }
+  bench::Rate(label, kRemote, bench::SecondsSince(start));
+  if (pool.GetFreeCount() != kBlocks) std::printf("  !! %u blocks missing\n", kBlocks - pool.GetFreeCount());
+}
+
+} // namespace
+
+int main()
+{
+  bench::Header("PoolCache: magazine layer over MemoryPool (M ops/s)");
+  bench::LeaveSingleThreaded();
+  for (PoolSync sync : {PoolSync::Mutex, PoolSync::LockFree}) {
+    const bool lf = sync == PoolSync::LockFree;
+    MemoryPool<Block> pool;
+    pool.Create(kBlocks, sync);
+    Pairs(lf ? "pairs, lock-free pool" : "pairs, mutex pool",
+          [&] { return pool.Alloc(); }, [&](Block* b) { pool.Free(b); });
+    Cache cache(pool);
+    Pairs(lf ? "pairs, cache over lock-free pool" : "pairs, cache over mutex pool",
+          [&] { return cache.Alloc(); }, [&](Block* b) { cache.Free(b); });
+  }
+  RemoteFree("remote free, mutex pool", PoolSync::Mutex, false);
+  RemoteFree("remote free, lock-free pool", PoolSync::LockFree, false);
+  RemoteFree("remote free, cache over mutex pool", PoolSync::Mutex, true);
+  RemoteFree("remote free, cache over lock-free pool", PoolSync::LockFree, true);
+  return 0;
+}
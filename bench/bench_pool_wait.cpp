@@ -0,0 +1,62 @@
+// Exhausted-pool handoff: a one-block pool whose block the main thread
+// holds while a second thread is parked in Alloc(WaitForever). Latency is
+// from the Free call to that Alloc returning. The waiter starts each
+// Alloc only once the main thread holds the block again (`go`), and the
+// main thread sleeps briefly before each Free so the waiter has parked.
+
+#include "bench.hpp"
+#include "osal/osal.hpp"
+#include <atomic>
+
+using namespace ifce::os;
+
+namespace {
+
+struct Block { uint64_t words[8]; };
+
+constexpr uint32_t kHandoffs = 5'000;
+
+void Run(const char* label, PoolSync sync)
+{
+  MemoryPool<Block> pool;
+  pool.Create(1, sync);
+  Semaphore go, done;
+  go.Create(1, 0);
+  done.Create(1, 0);
+  std::atomic<int64_t> freed_at {0};
+  std::vector<uint32_t> ns;
+  ns.reserve(kHandoffs);
+
+  Block* held = pool.Alloc();
+  std::thread waiter([&] {
+    for (uint32_t i = 0; i < kHandoffs; ++i) {
+      go.Acquire();
+      Block* b = pool.Alloc(WaitForever);
+      auto now = bench::Clock::now().time_since_epoch();
+      ns.push_back(uint32_t(std::chrono::nanoseconds(now).count() - freed_at.load()));
+      pool.Free(b);
+      done.Release();
+    }
+  });
+  for (uint32_t i = 0; i < kHandoffs; ++i) {
+    go.Release();
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    freed_at = std::chrono::nanoseconds(bench::Clock::now().time_since_epoch()).count();
+    pool.Free(held);
+    done.Acquire();
+    held = pool.Alloc();
+  }
+  waiter.join();
+  pool.Free(held);
+  bench::Latency(label, ns);
+}
+
+} // namespace
+
+int main()
+{
+  bench::Header("MemoryPool: Free -> blocked Alloc handoff");
+  Run("mutex free list", PoolSync::Mutex);
+  Run("lock-free free list", PoolSync::LockFree);
+  return 0;
+}
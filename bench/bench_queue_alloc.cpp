@@ -0,0 +1,117 @@
+// Steady-state heap traffic and Put latency of the preallocated rings. One
+// thread moves 64-byte messages through the queue in bursts of kBurst, so
+// the FIFO keeps walking around its storage. A std::deque behind a mutex,
+// the storage the queues used before, is the baseline.
+
+#include "bench.hpp"
+#include "osal/osal.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <new>
+
+using namespace ifce::os;
+
+namespace {
+
+std::atomic<uint64_t> g_allocs {0};
+
+} // namespace
+
+// Count every heap allocation in the process
+void* operator new(size_t size)
+{
+  g_allocs.fetch_add(1, std::memory_order_relaxed);
+  if (void* p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+void* operator new(size_t size, std::align_val_t align)
+{
+  g_allocs.fetch_add(1, std::memory_order_relaxed);
+  size_t a = static_cast<size_t>(align);
+  if (void* p = std::aligned_alloc(a, (size + a - 1) / a * a)) return p;
+  throw std::bad_alloc();
+}
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept
+{
+  g_allocs.fetch_add(1, std::memory_order_relaxed);
+  size_t a = static_cast<size_t>(align);
+  return std::aligned_alloc(a, (size + a - 1) / a * a);
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+namespace {
+
+struct Msg { uint64_t words[8]; };
+
+constexpr uint32_t kCapacity = 1024;
+constexpr uint32_t kBurst    = 200;
+constexpr uint32_t kRounds   = 10'000;
+
+/// The pre-ring storage: a mutex-guarded deque that grows on demand.
+struct DequeQueue
+{
+  OsStatus Create(uint32_t) { return OsStatus::Ok; }
+  OsStatus Put(const Msg& m, uint32_t = 0) { std::lock_guard<std::mutex> l(mutex); q.push_back(m); return OsStatus::Ok; }
+  OsStatus Get(Msg& m, uint32_t = 0)
+  {
+    std::lock_guard<std::mutex> l(mutex);
+    m = q.front();
+    q.pop_front();
+    return OsStatus::Ok;
+  }
+  std::mutex      mutex;
+  std::deque<Msg> q;
+};
+
+/// Hands out one static block, standing in for a caller's arena.
+alignas(CacheLineSize) unsigned char g_arena[kCapacity * sizeof(Msg) * 2];
+
+Allocator ArenaAllocator()
+{
+  Allocator a;
+  a.allocate   = [](size_t size, size_t, void*) -> void* { return size <= sizeof(g_arena) ? g_arena : nullptr; };
+  a.deallocate = [](void*, size_t, size_t, void*) {};
+  return a;
+}
+
+template <typename Queue, typename CreateFn>
+void Run(const char* label, CreateFn&& create)
+{
+  Queue q;
+  create(q);
+  Msg m{};
+  std::vector<uint32_t> ns;
+  ns.reserve(size_t(kRounds) * kBurst);
+  uint64_t before = g_allocs.load(std::memory_order_relaxed);
+  for (uint32_t r = 0; r < kRounds; ++r) {
+    for (uint32_t i = 0; i < kBurst; ++i) {
+      auto start = bench::Clock::now();
+      q.Put(m, 0);
+      ns.push_back(bench::NanosSince(start));
+    }
+    for (uint32_t i = 0; i < kBurst; ++i) q.Get(m, 0);
+  }
+  uint64_t allocs = g_allocs.load(std::memory_order_relaxed) - before;
+  // ns was reserved up front, so the allocations are the queue's own
+  std::printf("  %-40s %llu heap allocations\n", label, static_cast<unsigned long long>(allocs));
+  bench::Latency("  Put", ns);
+}
+
+} // namespace
+
+int main()
+{
+  bench::Header("Queue storage: steady-state allocations and Put latency");
+  bench::LeaveSingleThreaded();
+  Run<DequeQueue>("std::deque + mutex (old storage)", [](auto& q) { q.Create(kCapacity); });
+  Run<MessageQueue<Msg>>("MessageQueue", [](auto& q) { q.Create(kCapacity); });
+  Run<MessageQueue<Msg>>("MessageQueue, arena allocator", [](auto& q) { q.Create(kCapacity, ArenaAllocator()); });
+  Run<SpscMessageQueue<Msg>>("SpscMessageQueue", [](auto& q) { q.Create(kCapacity); });
+  Run<MpmcMessageQueue<Msg>>("MpmcMessageQueue", [](auto& q) { q.Create(kCapacity); });
+  return 0;
+}
@@ -0,0 +1,83 @@
+// Cross-process throughput: a forked producer sends 64-byte messages to
+// its parent through ShmMessageQueue, one at a time and in PutMany/GetMany
+// batches, against an AF_UNIX SOCK_SEQPACKET socketpair baseline. The time
+// runs from fork to the parent receiving the last message.
+
+#include "bench.hpp"
+#include "osal/osal.hpp"
+#include "osal/shm_message_queue.hpp"
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace ifce::os;
+
+namespace {
+
+struct Msg { uint64_t words[8]; };
+
+constexpr uint32_t kCapacity = 1024;
+constexpr uint32_t kBatch    = 64;
+constexpr uint64_t kMessages = 2'000'000;
+
+/// Forks `produce` into a child, runs `consume` here, and reports the rate.
+template <typename Produce, typename Consume>
+void Run(const char* label, Produce&& produce, Consume&& consume)
+{
+  auto start = bench::Clock::now();
+  pid_t pid = fork();
+  if (pid == 0) {
+    produce();
+    _exit(0);
+  }
+  consume();
+  double secs = bench::SecondsSince(start);
+  waitpid(pid, nullptr, 0);
+  bench::Rate(label, kMessages, secs);
+}
+
+} // namespace
+
+int main()
+{
+  bench::Header("Cross-process: ShmMessageQueue vs socketpair (64-byte msgs)");
+
+  {
+    ShmMessageQueue<Msg> q;
+    q.Create(kCapacity);
+    Run("ShmMessageQueue Put/Get",
+        [&] { Msg m{}; for (uint64_t i = 0; i < kMessages; ++i) q.Put(m); },
+        [&] { Msg m{}; for (uint64_t i = 0; i < kMessages; ++i) q.Get(m); });
+  }
+  {
+    ShmMessageQueue<Msg> q;
+    q.Create(kCapacity);
+    Run("ShmMessageQueue PutMany/GetMany",
+        [&] {
+          Msg batch[kBatch] = {};
+          for (uint64_t sent = 0; sent < kMessages;)
+            sent += q.PutMany(batch, uint32_t(std::min<uint64_t>(kBatch, kMessages - sent)));
+        },
+        [&] {
+          Msg batch[kBatch];
+          for (uint64_t got = 0; got < kMessages;) got += q.GetMany(batch, kBatch);
+        });
+  }
+  {
+    int sv[2];
+    socketpair(AF_UNIX, SOCK_SEQPACKET, 0, sv);
+    Run("AF_UNIX SOCK_SEQPACKET",
+        [&] {
+          close(sv[0]);
+          Msg m{};
+          for (uint64_t i = 0; i < kMessages; ++i) (void)!write(sv[1], &m, sizeof(m));
+        },
+        [&] {
+          close(sv[1]);
+          Msg m{};
+          for (uint64_t i = 0; i < kMessages; ++i) (void)!read(sv[0], &m, sizeof(m));
+        });
+    close(sv[0]);
+  }
+  return 0;
+}
@@ -0,0 +1,67 @@
+// One producer, one consumer: the mutex MessageQueue against the lock-free
+// SpscMessageQueue. Throughput streams kMessages through a kCapacity ring;
+// latency bounces one message between two queues and halves the round trip.
+
+#include "bench.hpp"
+#include "osal/osal.hpp"
+
+using namespace ifce::os;
+
+namespace {
+
+constexpr uint32_t kCapacity = 1024;
+constexpr uint64_t kMessages = 2'000'000;
+constexpr uint32_t kRoundTrips = 50'000;
+
+template <typename Queue>
+void Throughput(const char* label)
+{
+  Queue q;
+  q.Create(kCapacity);
+  auto start = bench::Clock::now();
+  std::thread producer([&] {
+    for (uint64_t i = 0; i < kMessages; ++i) q.Put(i);
+  });
+  uint64_t v = 0;
+  for (uint64_t i = 0; i < kMessages; ++i) q.Get(v);
+  producer.join();
+  bench::Rate(label, kMessages, bench::SecondsSince(start));
+}
+
+template <typename Queue>
+void PingPong(const char* label)
+{
+  Queue ping, pong;
+  ping.Create(kCapacity);
+  pong.Create(kCapacity);
+  std::thread echo([&] {
+    uint64_t v = 0;
+    for (uint32_t i = 0; i < kRoundTrips; ++i) {
+      ping.Get(v);
+      pong.Put(v);
+    }
+  });
+  std::vector<uint32_t> ns;
+  ns.reserve(kRoundTrips);
+  uint64_t v = 0;
+  for (uint32_t i = 0; i < kRoundTrips; ++i) {
+    auto start = bench::Clock::now();
+    ping.Put(uint64_t(i));
+    pong.Get(v);
+    ns.push_back(bench::NanosSince(start) / 2);
+  }
+  echo.join();
+  bench::Latency(label, ns);
+}
+
+} // namespace
+
+int main()
+{
+  bench::Header("SPSC: MessageQueue vs SpscMessageQueue");
+  Throughput<MessageQueue<uint64_t>>("MessageQueue throughput");
+  Throughput<SpscMessageQueue<uint64_t>>("SpscMessageQueue throughput");
+  PingPong<MessageQueue<uint64_t>>("MessageQueue one-way");
+  PingPong<SpscMessageQueue<uint64_t>>("SpscMessageQueue one-way");
+  return 0;
+}
@@ -14,6 +14,17 @@ set(SRCS_DIR "${CMAKE_CURRENT_LIST_DIR}/../src")
 #   OSAL_BACKEND_CMSIS_RTOS2
 #   OSAL_BACKEND_POSIX
 #   OSAL_BACKEND_CPP_STD
+#
+# OSAL_POSIX_FUTEX — with OSAL_BACKEND_POSIX on Linux, park MessageQueue,
+#   Semaphore and EventFlags waiters on futexes instead of pthread condvars
+#
+# OSAL_QUEUE_STATS — record MessageQueue::GetStats() counters (any backend)
+#
+# OSAL_BUILD_BENCH — build the bench/ programs (POSIX or CPP_STD backend);
+#   `cmake --build <dir> --target bench` runs them all
+#
+# OSAL_BUILD_TESTS — build the test/ programs (POSIX or CPP_STD backend);
+#   run them with ctest
 
 add_library(interface-embedded INTERFACE)
 
@@ -42,6 +53,9 @@ elseif(OSAL_BACKEND_CMSIS_RTOS2)
   target_compile_definitions(interface-embedded INTERFACE OSAL_BACKEND_CMSIS_RTOS2=1)
 elseif(OSAL_BACKEND_POSIX)
   target_compile_definitions(interface-embedded INTERFACE OSAL_BACKEND_POSIX=1)
+  if(OSAL_POSIX_FUTEX)
+    target_compile_definitions(interface-embedded INTERFACE OSAL_POSIX_FUTEX=1)
+  endif()
   find_package(Threads REQUIRED)
   target_link_libraries(interface-embedded INTERFACE Threads::Threads)
 elseif(OSAL_BACKEND_CPP_STD)
@@ -49,3 +63,24 @@ elseif(OSAL_BACKEND_CPP_STD)
   find_package(Threads REQUIRED)
   target_link_libraries(interface-embedded INTERFACE Threads::Threads)
 endif()
+
+if(OSAL_QUEUE_STATS)
+  target_compile_definitions(interface-embedded INTERFACE OSAL_QUEUE_STATS=1)
+endif()
+
+# --- Benchmarks (optional) ---
+if(OSAL_BUILD_BENCH)
+  if(NOT (OSAL_BACKEND_POSIX OR OSAL_BACKEND_CPP_STD))
+    message(FATAL_ERROR "OSAL_BUILD_BENCH needs OSAL_BACKEND_POSIX or OSAL_BACKEND_CPP_STD")
+  endif()
+  add_subdirectory("${CMAKE_CURRENT_LIST_DIR}/../bench" "${CMAKE_BINARY_DIR}/bench")
+endif()
+
+# --- Tests (optional) ---
+if(OSAL_BUILD_TESTS)
+  if(NOT (OSAL_BACKEND_POSIX OR OSAL_BACKEND_CPP_STD))
+    message(FATAL_ERROR "OSAL_BUILD_TESTS needs OSAL_BACKEND_POSIX or OSAL_BACKEND_CPP_STD")
+  endif()
+  enable_testing()
+  add_subdirectory("${CMAKE_CURRENT_LIST_DIR}/../test" "${CMAKE_BINARY_DIR}/test")
+endif()
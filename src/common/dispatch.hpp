@@ -3,9 +3,10 @@
 /// @file dispatch.hpp
 /// @brief CRTP dispatch helpers using if-constexpr + lambda SFINAE.
 ///
-/// Provides three dispatch patterns:
+/// Provides four dispatch patterns:
 ///   Dispatch  — optional void call (no-op if Derived lacks the method)
 ///   Query     — optional call with return value (returns fallback if missing)
+///   QueryOr   — optional call that runs a generic fallback if missing
 ///   Invoke    — mandatory call (static_assert fires if Derived lacks the method)
 ///
 /// This is a shared utility used by both OSAL abilities and Logger.
@@ -60,6 +61,17 @@ protected:
       return fallback;
   }
 
+  // --- QueryOr: optional call, generic fallback composed from other methods ---
+
+  template <typename Fn, typename FallbackFn, typename... Args>
+  auto QueryOr(Fn&& fn, FallbackFn&& fallback, Args&&... args)
+  {
+    if constexpr (std::is_invocable_v<Fn, Derived*, Args...>)
+      return std::forward<Fn>(fn)(static_cast<Derived*>(this), std::forward<Args>(args)...);
+    else
+      return std::forward<FallbackFn>(fallback)(static_cast<Derived*>(this), std::forward<Args>(args)...);
+  }
+
   // --- Invoke: mandatory call (compile error if Derived lacks the method) ---
 
   template <typename Fn, typename... Args>
@@ -59,11 +59,33 @@ public:
 
   // --- Optional ---
 
+  /// Wait against an absolute monotonic deadline.
+  uint32_t Wait(uint32_t flags, bool wait_all, bool auto_clear, const Deadline& deadline)
+  {
+    return Base::QueryOr(
+      [](auto* s, uint32_t f, bool wa, bool ac, const Deadline& d)
+        -> decltype(s->WaitImpl(f, wa, ac, d)) {
+          return s->WaitImpl(f, wa, ac, d);
+      },
+      [](auto* s, uint32_t f, bool wa, bool ac, const Deadline& d) -> uint32_t {
+        return s->Wait(f, wa, ac, d.RemainingMs());
+      }, flags, wait_all, auto_clear, deadline);
+  }
+
   uint32_t Get() const
   {
     return Base::Query(uint32_t(0),
       [](const auto* s) -> decltype(s->GetImpl()) { return s->GetImpl(); });
   }
+
+  /// Descriptor that polls readable while any flag is set, so an
+  /// epoll/poll loop can wait on it next to sockets. Consume through the
+  /// normal API, never by reading the fd. -1 if the backend has none.
+  int GetNativeFd()
+  {
+    return Base::QueryMut(-1,
+      [](auto* s) -> decltype(s->GetNativeFdImpl()) { return s->GetNativeFdImpl(); });
+  }
 };
 
 } // namespace ifce::os
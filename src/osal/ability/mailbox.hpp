@@ -0,0 +1,89 @@
+#pragma once
+
+#include "osal/types.hpp"
+#include "osal/ability/dispatch.hpp"
+#include <cstdint>
+
+namespace ifce::os {
+
+/// Single-slot "latest value" channel.
+///
+/// Overwrite() replaces whatever is stored and never blocks. Peek() copies
+/// the current value and leaves it in place; Take() copies it and empties
+/// the mailbox, so each written value is taken at most once. Both wait up
+/// to `timeout_ms` for a value to be available.
+template <typename Derived, typename T>
+class MailboxAbility : protected ifce::DispatchBase<Derived>
+{
+  friend Derived;
+  using Base = ifce::DispatchBase<Derived>;
+
+public:
+  MailboxAbility()  = default;
+  ~MailboxAbility() = default;
+
+  MailboxAbility(const MailboxAbility&)            = delete;
+  MailboxAbility& operator=(const MailboxAbility&) = delete;
+
+  // --- Mandatory ---
+
+  OsStatus Create()
+  {
+    return Base::Invoke(
+      [](auto* s) -> decltype(s->CreateImpl()) { return s->CreateImpl(); });
+  }
+
+  OsStatus Delete()
+  {
+    return Base::Invoke(
+      [](auto* s) -> decltype(s->DeleteImpl()) { return s->DeleteImpl(); });
+  }
+
+  OsStatus Overwrite(const T& msg)
+  {
+    return Base::Invoke(
+      [](auto* s, const T& m) -> decltype(s->OverwriteImpl(m)) { return s->OverwriteImpl(m); },
+      msg);
+  }
+
+  OsStatus Peek(T& msg, uint32_t timeout_ms = WaitForever)
+  {
+    return Base::Invoke(
+      [](auto* s, T& m, uint32_t t) -> decltype(s->PeekImpl(m, t)) { return s->PeekImpl(m, t); },
+      msg, timeout_ms);
+  }
+
+  OsStatus Take(T& msg, uint32_t timeout_ms = WaitForever)
+  {
+    return Base::Invoke(
+      [](auto* s, T& m, uint32_t t) -> decltype(s->TakeImpl(m, t)) { return s->TakeImpl(m, t); },
+      msg, timeout_ms);
+  }
+
+  // --- Optional ---
+
+  /// Peek/Take against an absolute monotonic deadline.
+  OsStatus Peek(T& msg, const Deadline& deadline)
+  {
+    return Base::QueryOr(
+      [](auto* s, T& m, const Deadline& d) -> decltype(s->PeekImpl(m, d)) { return s->PeekImpl(m, d); },
+      [](auto* s, T& m, const Deadline& d) -> OsStatus { return s->Peek(m, d.RemainingMs()); },
+      msg, deadline);
+  }
+
+  OsStatus Take(T& msg, const Deadline& deadline)
+  {
+    return Base::QueryOr(
+      [](auto* s, T& m, const Deadline& d) -> decltype(s->TakeImpl(m, d)) { return s->TakeImpl(m, d); },
+      [](auto* s, T& m, const Deadline& d) -> OsStatus { return s->Take(m, d.RemainingMs()); },
+      msg, deadline);
+  }
+
+  bool IsEmpty() const
+  {
+    return Base::Query(true,
+      [](const auto* s) -> decltype(s->IsEmptyImpl()) { return s->IsEmptyImpl(); });
+  }
+};
+
+} // namespace ifce::os
@@ -2,9 +2,11 @@
 
 #include "osal/types.hpp"
 #include "osal/ability/dispatch.hpp"
+#include "osal/pool_ptr.hpp"
 #include <cstdint>
 #include <cstddef>
 #include <new>
+#include <utility>
 
 namespace ifce::os {
 
@@ -36,6 +38,7 @@ public:
       [](auto* s) -> decltype(s->DeleteImpl()) { return s->DeleteImpl(); });
   }
 
+  /// Waits up to `timeout_ms` for a free block (0 polls); nullptr on timeout.
   T* Alloc(uint32_t timeout_ms = 0)
   {
     return Base::Invoke(
@@ -52,6 +55,78 @@ public:
 
   // --- Optional ---
 
+  /// Create with an explicit free-list discipline. Backends whose native
+  /// pool already has its own synchronization ignore the choice.
+  OsStatus Create(uint32_t block_count, PoolSync sync)
+  {
+    return Base::QueryOr(
+      [](auto* s, uint32_t c, PoolSync y) -> decltype(s->CreateImpl(c, y)) {
+        return s->CreateImpl(c, y);
+      },
+      [](auto* s, uint32_t c, PoolSync) -> OsStatus {
+        return s->Create(c);
+      }, block_count, sync);
+  }
+
+  /// Alloc against an absolute monotonic deadline. Backends without native
+  /// support convert the remaining time to milliseconds.
+  T* Alloc(const Deadline& deadline)
+  {
+    return Base::QueryOr(
+      [](auto* s, const Deadline& d) -> decltype(s->AllocImpl(d)) { return s->AllocImpl(d); },
+      [](auto* s, const Deadline& d) -> T* { return s->Alloc(d.RemainingMs()); },
+      deadline);
+  }
+
+  /// Allocates a block without waiting and constructs a T in it. The handle
+  /// destroys the object and frees the block when it goes out of scope; it
+  /// is empty if the pool is exhausted.
+  template <typename... Args>
+  PoolPtr<T> Make(Args&&... args)
+  {
+    return PoolPtr<T>::Make(*static_cast<Derived*>(this), std::forward<Args>(args)...);
+  }
+
+  /// Takes up to `count` blocks without waiting; returns how many were
+  /// stored in `out`. Backends with a central lock take it once per batch.
+  uint32_t AllocBatch(T** out, uint32_t count)
+  {
+    return Base::QueryOr(
+      [](auto* s, T** o, uint32_t c) -> decltype(s->AllocBatchImpl(o, c)) {
+        return s->AllocBatchImpl(o, c);
+      },
+      [](auto* s, T** o, uint32_t c) -> uint32_t {
+        uint32_t n = 0;
+        for (; n < c; ++n)
+          if (!(o[n] = s->Alloc(0))) break;
+        return n;
+      }, out, count);
+  }
+
+  /// Returns `count` blocks to the pool; returns how many were accepted
+  /// (blocks that do not belong to the pool are skipped).
+  uint32_t FreeBatch(T* const* blocks, uint32_t count)
+  {
+    return Base::QueryOr(
+      [](auto* s, T* const* b, uint32_t c) -> decltype(s->FreeBatchImpl(b, c)) {
+        return s->FreeBatchImpl(b, c);
+      },
+      [](auto* s, T* const* b, uint32_t c) -> uint32_t {
+        uint32_t n = 0;
+        for (uint32_t i = 0; i < c; ++i)
+          if (s->Free(b[i]) == OsStatus::Ok) ++n;
+        return n;
+      }, blocks, count);
+  }
+
+  /// True if `block` is one of this pool's blocks. Backends that cannot
+  /// tell report true and leave the check to Free().
+  bool Owns(const T* block) const
+  {
+    return Base::Query(true,
+      [block](const auto* s) -> decltype(s->OwnsImpl(block)) { return s->OwnsImpl(block); });
+  }
+
   uint32_t GetCount() const
   {
     return Base::Query(uint32_t(0),
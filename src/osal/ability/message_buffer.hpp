@@ -0,0 +1,149 @@
+#pragma once
+
+#include "osal/types.hpp"
+#include "osal/ability/dispatch.hpp"
+#include "osal/ability/stream_buffer.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace ifce::os {
+
+/// Variable-length messages between one writer and one reader.
+///
+/// Each message is stored with a length prefix, which counts against the
+/// capacity given to Create(). Send() is all-or-nothing: it waits up to
+/// `timeout_ms` for room and returns `len`, or 0 if the message did not
+/// fit (empty messages are rejected). Receive() returns the length of the
+/// message copied out, or 0 on timeout or if the next message is longer
+/// than `max` (it stays queued; GetNextLength() tells how big a buffer it
+/// needs).
+template <typename Derived>
+class MessageBufferAbility : protected ifce::DispatchBase<Derived>
+{
+  friend Derived;
+  using Base = ifce::DispatchBase<Derived>;
+
+public:
+  MessageBufferAbility()  = default;
+  ~MessageBufferAbility() = default;
+
+  MessageBufferAbility(const MessageBufferAbility&)            = delete;
+  MessageBufferAbility& operator=(const MessageBufferAbility&) = delete;
+
+  // --- Mandatory ---
+
+  OsStatus Create(size_t capacity)
+  {
+    return Base::Invoke(
+      [](auto* s, size_t c) -> decltype(s->CreateImpl(c)) { return s->CreateImpl(c); },
+      capacity);
+  }
+
+  OsStatus Delete()
+  {
+    return Base::Invoke(
+      [](auto* s) -> decltype(s->DeleteImpl()) { return s->DeleteImpl(); });
+  }
+
+  size_t Send(const void* data, size_t len, uint32_t timeout_ms = WaitForever)
+  {
+    return Base::Invoke(
+      [](auto* s, const void* d, size_t n, uint32_t t) -> decltype(s->SendImpl(d, n, t)) {
+        return s->SendImpl(d, n, t);
+      }, data, len, timeout_ms);
+  }
+
+  size_t Receive(void* data, size_t max, uint32_t timeout_ms = WaitForever)
+  {
+    return Base::Invoke(
+      [](auto* s, void* d, size_t n, uint32_t t) -> decltype(s->ReceiveImpl(d, n, t)) {
+        return s->ReceiveImpl(d, n, t);
+      }, data, max, timeout_ms);
+  }
+
+  // --- Optional ---
+
+  size_t Send(const void* data, size_t len, const Deadline& deadline)
+  {
+    return Base::QueryOr(
+      [](auto* s, const void* d, size_t n, const Deadline& dl) -> decltype(s->SendImpl(d, n, dl)) {
+        return s->SendImpl(d, n, dl);
+      },
+      [](auto* s, const void* d, size_t n, const Deadline& dl) -> size_t {
+        return s->Send(d, n, dl.RemainingMs());
+      }, data, len, deadline);
+  }
+
+  size_t Receive(void* data, size_t max, const Deadline& deadline)
+  {
+    return Base::QueryOr(
+      [](auto* s, void* d, size_t n, const Deadline& dl) -> decltype(s->ReceiveImpl(d, n, dl)) {
+        return s->ReceiveImpl(d, n, dl);
+      },
+      [](auto* s, void* d, size_t n, const Deadline& dl) -> size_t {
+        return s->Receive(d, n, dl.RemainingMs());
+      }, data, max, deadline);
+  }
+
+  /// Length of the next message, 0 if none is queued.
+  size_t GetNextLength() const
+  {
+    return Base::Query(size_t(0),
+      [](const auto* s) -> decltype(s->GetNextLengthImpl()) { return s->GetNextLengthImpl(); });
+  }
+
+  /// Free bytes, including what a new message's length prefix will use.
+  size_t GetSpace() const
+  {
+    return Base::Query(size_t(0),
+      [](const auto* s) -> decltype(s->GetSpaceImpl()) { return s->GetSpaceImpl(); });
+  }
+
+  bool IsEmpty() const
+  {
+    return Base::Query(true,
+      [](const auto* s) -> decltype(s->IsEmptyImpl()) { return s->IsEmptyImpl(); });
+  }
+
+  OsStatus Reset()
+  {
+    return Base::QueryMut(OsStatus::Error,
+      [](auto* s) -> decltype(s->ResetImpl()) { return s->ResetImpl(); });
+  }
+
+  // --- Optional: zero-copy span access ---
+  //
+  // Writer: Reserve() room for a message of up to `max_len` bytes, fill the
+  // returned spans, then Commit() the actual length. Reader: Acquire() the
+  // next message's payload, parse it in place, then Release() it. An empty
+  // SpanPair means the wait timed out or the backend has no span access.
+
+  SpanPair Reserve(size_t max_len, uint32_t timeout_ms = WaitForever)
+  {
+    return Base::QueryMut(SpanPair{},
+      [](auto* s, size_t n, uint32_t t) -> decltype(s->ReserveImpl(n, t)) { return s->ReserveImpl(n, t); },
+      max_len, timeout_ms);
+  }
+
+  OsStatus Commit(size_t len)
+  {
+    return Base::QueryMut(OsStatus::Error,
+      [](auto* s, size_t n) -> decltype(s->CommitImpl(n)) { return s->CommitImpl(n); },
+      len);
+  }
+
+  SpanPair Acquire(uint32_t timeout_ms = WaitForever)
+  {
+    return Base::QueryMut(SpanPair{},
+      [](auto* s, uint32_t t) -> decltype(s->AcquireImpl(t)) { return s->AcquireImpl(t); },
+      timeout_ms);
+  }
+
+  OsStatus Release()
+  {
+    return Base::QueryMut(OsStatus::Error,
+      [](auto* s) -> decltype(s->ReleaseImpl()) { return s->ReleaseImpl(); });
+  }
+};
+
+} // namespace ifce::os
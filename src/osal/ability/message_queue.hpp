@@ -3,6 +3,8 @@
 #include "osal/types.hpp"
 #include "osal/ability/dispatch.hpp"
 #include <cstdint>
+#include <type_traits>
+#include <utility>
 
 namespace ifce::os {
 
@@ -42,6 +44,15 @@ public:
       }, msg, timeout_ms);
   }
 
+  OsStatus Put(T&& msg, uint32_t timeout_ms = WaitForever)
+  {
+    return Base::Invoke(
+      [](auto* s, T&& m, uint32_t t) -> decltype(s->PutImpl(std::move(m), t)) {
+        return s->PutImpl(std::move(m), t);
+      }, std::move(msg), timeout_ms);
+  }
+
+  /// Get moves the message out of the queue where the backend supports it.
   OsStatus Get(T& msg, uint32_t timeout_ms = WaitForever)
   {
     return Base::Invoke(
@@ -52,6 +63,92 @@ public:
 
   // --- Optional ---
 
+  /// Create with the ring storage taken from `allocator` instead of the heap.
+  OsStatus Create(uint32_t capacity, const Allocator& allocator,
+                  const SpinPolicy& spin = SpinPolicy{})
+  {
+    return Base::QueryMut(OsStatus::Error,
+      [](auto* s, uint32_t c, const Allocator& a, const SpinPolicy& p)
+        -> decltype(s->CreateImpl(c, a, p)) { return s->CreateImpl(c, a, p); },
+      capacity, allocator, spin);
+  }
+
+  /// Create with what Put does while the queue is full. Lossy policies
+  /// never make the producer wait; a rejected Put fails with Timeout.
+  OsStatus Create(uint32_t capacity, OverflowPolicy policy)
+  {
+    return Base::QueryMut(OsStatus::Error,
+      [](auto* s, uint32_t c, OverflowPolicy p) -> decltype(s->CreateImpl(c, p)) {
+        return s->CreateImpl(c, p);
+      }, capacity, policy);
+  }
+
+  /// Create with a spin budget other than the compile-time default.
+  OsStatus Create(uint32_t capacity, const SpinPolicy& spin)
+  {
+    return Create(capacity, Allocator{}, spin);
+  }
+
+  /// Put/Get against an absolute monotonic deadline, so retry loops can
+  /// share one time budget. Backends without native support convert the
+  /// remaining time to milliseconds.
+  OsStatus Put(const T& msg, const Deadline& deadline)
+  {
+    return Base::QueryOr(
+      [](auto* s, const T& m, const Deadline& d) -> decltype(s->PutImpl(m, d)) {
+        return s->PutImpl(m, d);
+      },
+      [](auto* s, const T& m, const Deadline& d) -> OsStatus {
+        return s->Put(m, d.RemainingMs());
+      }, msg, deadline);
+  }
+
+  OsStatus Put(T&& msg, const Deadline& deadline)
+  {
+    return Base::QueryOr(
+      [](auto* s, T&& m, const Deadline& d) -> decltype(s->PutImpl(std::move(m), d)) {
+        return s->PutImpl(std::move(m), d);
+      },
+      [](auto* s, T&& m, const Deadline& d) -> OsStatus {
+        return s->Put(std::move(m), d.RemainingMs());
+      }, std::move(msg), deadline);
+  }
+
+  OsStatus Get(T& msg, const Deadline& deadline)
+  {
+    return Base::QueryOr(
+      [](auto* s, T& m, const Deadline& d) -> decltype(s->GetImpl(m, d)) {
+        return s->GetImpl(m, d);
+      },
+      [](auto* s, T& m, const Deadline& d) -> OsStatus {
+        return s->Get(m, d.RemainingMs());
+      }, msg, deadline);
+  }
+
+  /// Enqueue with a priority: higher values are dequeued first, FIFO within
+  /// a priority. Backends without priorities fall back to a plain Put.
+  OsStatus Put(const T& msg, uint8_t priority, uint32_t timeout_ms)
+  {
+    return Base::QueryOr(
+      [](auto* s, const T& m, uint8_t p, uint32_t t) -> decltype(s->PutImpl(m, p, t)) {
+        return s->PutImpl(m, p, t);
+      },
+      [](auto* s, const T& m, uint8_t, uint32_t t) -> OsStatus {
+        return s->Put(m, t);
+      }, msg, priority, timeout_ms);
+  }
+
+  OsStatus Put(T&& msg, uint8_t priority, uint32_t timeout_ms)
+  {
+    return Base::QueryOr(
+      [](auto* s, T&& m, uint8_t p, uint32_t t) -> decltype(s->PutImpl(std::move(m), p, t)) {
+        return s->PutImpl(std::move(m), p, t);
+      },
+      [](auto* s, T&& m, uint8_t, uint32_t t) -> OsStatus {
+        return s->Put(std::move(m), t);
+      }, std::move(msg), priority, timeout_ms);
+  }
+
   OsStatus PutToFront(const T& msg, uint32_t timeout_ms = WaitForever)
   {
     return Base::QueryMut(OsStatus::Error,
@@ -60,6 +157,132 @@ public:
       }, msg, timeout_ms);
   }
 
+  OsStatus PutToFront(T&& msg, uint32_t timeout_ms = WaitForever)
+  {
+    return Base::QueryMut(OsStatus::Error,
+      [](auto* s, T&& m, uint32_t t) -> decltype(s->PutToFrontImpl(std::move(m), t)) {
+        return s->PutToFrontImpl(std::move(m), t);
+      }, std::move(msg), timeout_ms);
+  }
+
+  /// Construct the message in place, blocking until space is available.
+  /// Backends without native support build a temporary and move it in.
+  template <typename... Args>
+  OsStatus Emplace(Args&&... args)
+  {
+    return EmplaceFor(WaitForever, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  OsStatus EmplaceFor(uint32_t timeout_ms, Args&&... args)
+  {
+    return Base::QueryOr(
+      [](auto* s, uint32_t t, auto&&... a)
+        -> decltype(s->EmplaceImpl(t, std::forward<decltype(a)>(a)...)) {
+          return s->EmplaceImpl(t, std::forward<decltype(a)>(a)...);
+      },
+      [](auto* s, uint32_t t, auto&&... a) -> OsStatus {
+        return s->Put(T(std::forward<decltype(a)>(a)...), t);
+      }, timeout_ms, std::forward<Args>(args)...);
+  }
+
+  /// Enqueue up to `count` messages, blocking for space as needed.
+  /// Returns the number actually enqueued (less than `count` on timeout).
+  /// Backends without native batching fall back to one Put per message,
+  /// with the timeout applied to each.
+  uint32_t PutMany(const T* msgs, uint32_t count, uint32_t timeout_ms = WaitForever)
+  {
+    return Base::QueryOr(
+      [](auto* s, const T* m, uint32_t n, uint32_t t) -> decltype(s->PutManyImpl(m, n, t)) {
+        return s->PutManyImpl(m, n, t);
+      },
+      [](auto* s, const T* m, uint32_t n, uint32_t t) -> uint32_t {
+        uint32_t done = 0;
+        while (done < n && s->Put(m[done], t) == OsStatus::Ok)
+          ++done;
+        return done;
+      }, msgs, count, timeout_ms);
+  }
+
+  /// Wait for at least one message, then dequeue up to `max` without
+  /// further blocking. Returns the number dequeued (0 on timeout).
+  uint32_t GetMany(T* msgs, uint32_t max, uint32_t timeout_ms = WaitForever)
+  {
+    return Base::QueryOr(
+      [](auto* s, T* m, uint32_t n, uint32_t t) -> decltype(s->GetManyImpl(m, n, t)) {
+        return s->GetManyImpl(m, n, t);
+      },
+      [](auto* s, T* m, uint32_t n, uint32_t t) -> uint32_t {
+        if (n == 0 || s->Get(m[0], t) != OsStatus::Ok) return 0;
+        uint32_t done = 1;
+        while (done < n && s->Get(m[done], 0) == OsStatus::Ok)
+          ++done;
+        return done;
+      }, msgs, max, timeout_ms);
+  }
+
+  /// Wait for at least one message, then call `fn(T&)` on each queued
+  /// message, up to `max`, in dequeue order. The messages are destroyed
+  /// once `fn` has seen them, so `fn` may move from them. Returns the number
+  /// consumed (0 on timeout). Native backends take the queue lock once for
+  /// the whole batch, and still destroy the batch if `fn` throws; others
+  /// fall back to one Get per message, which needs a default-constructible T.
+  template <typename Fn>
+  uint32_t Consume(Fn&& fn, uint32_t max = UINT32_MAX, uint32_t timeout_ms = WaitForever)
+  {
+    return Base::QueryOr(
+      [](auto* s, auto& f, uint32_t n, uint32_t t) -> decltype(s->ConsumeImpl(f, n, t)) {
+        return s->ConsumeImpl(f, n, t);
+      },
+      [](auto* s, auto& f, uint32_t n, uint32_t t) -> uint32_t {
+        // Dependent on `s` so only backends that take this path need it
+        using Msg = std::conditional_t<true, T, decltype(s)>;
+        static_assert(std::is_default_constructible_v<Msg>,
+                      "Consume() falls back to Get() on this backend, which needs a default-constructible T");
+        uint32_t done = 0;
+        Msg msg;
+        while (done < n && s->Get(msg, done ? 0 : t) == OsStatus::Ok) {
+          f(msg);
+          ++done;
+        }
+        return done;
+      }, fn, max, timeout_ms);
+  }
+
+  // --- Optional: zero-copy loans ---
+  //
+  // Producer: Reserve() a default-constructed slot, fill it in place, then
+  // Commit() it. Consumer: Acquire() the oldest message, read it in place,
+  // then Release() it. Every loan must be returned exactly once.
+
+  T* Reserve(uint32_t timeout_ms = WaitForever)
+  {
+    return Base::QueryMut(static_cast<T*>(nullptr),
+      [](auto* s, uint32_t t) -> decltype(s->ReserveImpl(t)) { return s->ReserveImpl(t); },
+      timeout_ms);
+  }
+
+  OsStatus Commit(T* slot)
+  {
+    return Base::QueryMut(OsStatus::Error,
+      [](auto* s, T* p) -> decltype(s->CommitImpl(p)) { return s->CommitImpl(p); },
+      slot);
+  }
+
+  T* Acquire(uint32_t timeout_ms = WaitForever)
+  {
+    return Base::QueryMut(static_cast<T*>(nullptr),
+      [](auto* s, uint32_t t) -> decltype(s->AcquireImpl(t)) { return s->AcquireImpl(t); },
+      timeout_ms);
+  }
+
+  OsStatus Release(T* slot)
+  {
+    return Base::QueryMut(OsStatus::Error,
+      [](auto* s, T* p) -> decltype(s->ReleaseImpl(p)) { return s->ReleaseImpl(p); },
+      slot);
+  }
+
   uint32_t GetCount() const
   {
     return Base::Query(uint32_t(0),
@@ -72,11 +295,41 @@ public:
       [](const auto* s) -> decltype(s->GetCapacityImpl()) { return s->GetCapacityImpl(); });
   }
 
+  SpinStats GetSpinStats() const
+  {
+    return Base::Query(SpinStats{},
+      [](const auto* s) -> decltype(s->GetSpinStatsImpl()) { return s->GetSpinStatsImpl(); });
+  }
+
+  /// Messages rejected or evicted by the overflow policy since Create.
+  DropStats GetDropStats() const
+  {
+    return Base::Query(DropStats{},
+      [](const auto* s) -> decltype(s->GetDropStatsImpl()) { return s->GetDropStatsImpl(); });
+  }
+
+  /// Depth, throughput, wait-time and latency counters. All zero unless
+  /// built with OSAL_QUEUE_STATS=1, and on backends that keep none.
+  QueueStats GetStats() const
+  {
+    return Base::Query(QueueStats{},
+      [](const auto* s) -> decltype(s->GetStatsImpl()) { return s->GetStatsImpl(); });
+  }
+
   OsStatus Reset()
   {
     return Base::QueryMut(OsStatus::Error,
       [](auto* s) -> decltype(s->ResetImpl()) { return s->ResetImpl(); });
   }
+
+  /// Descriptor that polls readable while a message is queued, so an
+  /// epoll/poll loop can wait on it next to sockets. Consume through the
+  /// normal API, never by reading the fd. -1 if the backend has none.
+  int GetNativeFd()
+  {
+    return Base::QueryMut(-1,
+      [](auto* s) -> decltype(s->GetNativeFdImpl()) { return s->GetNativeFdImpl(); });
+  }
 };
 
 } // namespace ifce::os
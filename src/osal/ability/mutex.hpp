@@ -49,11 +49,35 @@ public:
 
   // --- Optional ---
 
+  /// Create with a spin budget other than the compile-time default.
+  OsStatus Create(bool recursive, const SpinPolicy& spin)
+  {
+    return Base::QueryMut(OsStatus::Error,
+      [](auto* s, bool r, const SpinPolicy& p) -> decltype(s->CreateImpl(r, p)) {
+        return s->CreateImpl(r, p);
+      }, recursive, spin);
+  }
+
+  /// Lock against an absolute monotonic deadline.
+  OsStatus Lock(const Deadline& deadline)
+  {
+    return Base::QueryOr(
+      [](auto* s, const Deadline& d) -> decltype(s->LockImpl(d)) { return s->LockImpl(d); },
+      [](auto* s, const Deadline& d) -> OsStatus { return s->Lock(d.RemainingMs()); },
+      deadline);
+  }
+
   OsStatus TryLock()
   {
     return Base::QueryMut(OsStatus::Error,
       [](auto* s) -> decltype(s->TryLockImpl()) { return s->TryLockImpl(); });
   }
+
+  SpinStats GetSpinStats() const
+  {
+    return Base::Query(SpinStats{},
+      [](const auto* s) -> decltype(s->GetSpinStatsImpl()) { return s->GetSpinStatsImpl(); });
+  }
 };
 
 } // namespace ifce::os
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "osal/types.hpp"
+#include "osal/ability/dispatch.hpp"
+#include <cstdint>
+
+namespace ifce::os {
+
+namespace detail {
+
+/// Intrusive link a member keeps while it belongs to a QueueSet, so a set
+/// deleted before its members can still reach them and unbind each one.
+struct QueueSetHook
+{
+  QueueSetHook* next   = nullptr;
+  void*         member = nullptr;
+  void        (*unbind)(void* member) = nullptr;
+};
+
+} // namespace detail
+
+/// Block on several MessageQueues/Semaphores with a single wait.
+///
+/// Every item put into a member (message or semaphore release) posts one
+/// event to the set; Select() returns the member that produced the oldest
+/// pending event, which the caller then reads with a zero timeout. As with
+/// FreeRTOS queue sets:
+///  - `max_events` must cover the combined capacity of all members,
+///  - members are added/removed while empty and not in use,
+///  - members of a set are only read after Select() returned them,
+///  - deleting the set unbinds any members still attached, and (except on
+///    FreeRTOS, where the kernel owns membership) deleting a member takes
+///    it out of its set; both only while the members are not in use.
+template <typename Derived>
+class QueueSetAbility : protected ifce::DispatchBase<Derived>
+{
+  friend Derived;
+  using Base = ifce::DispatchBase<Derived>;
+
+public:
+  QueueSetAbility()  = default;
+  ~QueueSetAbility() = default;
+
+  QueueSetAbility(const QueueSetAbility&)            = delete;
+  QueueSetAbility& operator=(const QueueSetAbility&) = delete;
+
+  // --- Mandatory ---
+
+  OsStatus Create(uint32_t max_events)
+  {
+    return Base::Invoke(
+      [](auto* s, uint32_t n) -> decltype(s->CreateImpl(n)) { return s->CreateImpl(n); },
+      max_events);
+  }
+
+  OsStatus Delete()
+  {
+    return Base::Invoke(
+      [](auto* s) -> decltype(s->DeleteImpl()) { return s->DeleteImpl(); });
+  }
+
+  /// Busy if `member` is not empty or already belongs to a set.
+  template <typename Member>
+  OsStatus Add(Member& member)
+  {
+    return Base::Invoke(
+      [](auto* s, Member& m) -> decltype(s->AddImpl(m)) { return s->AddImpl(m); },
+      member);
+  }
+
+  template <typename Member>
+  OsStatus Remove(Member& member)
+  {
+    return Base::Invoke(
+      [](auto* s, Member& m) -> decltype(s->RemoveImpl(m)) { return s->RemoveImpl(m); },
+      member);
+  }
+
+  /// Returns the address of the ready member (compare against &queue),
+  /// or nullptr on timeout.
+  const void* Select(uint32_t timeout_ms = WaitForever)
+  {
+    return Base::Invoke(
+      [](auto* s, uint32_t t) -> decltype(s->SelectImpl(t)) { return s->SelectImpl(t); },
+      timeout_ms);
+  }
+
+  // --- Optional ---
+
+  /// Select against an absolute monotonic deadline.
+  const void* Select(const Deadline& deadline)
+  {
+    return Base::QueryOr(
+      [](auto* s, const Deadline& d) -> decltype(s->SelectImpl(d)) { return s->SelectImpl(d); },
+      [](auto* s, const Deadline& d) -> const void* { return s->Select(d.RemainingMs()); },
+      deadline);
+  }
+};
+
+} // namespace ifce::os
@@ -50,11 +50,44 @@ public:
 
   // --- Optional ---
 
+  /// Create with a spin budget other than the compile-time default.
+  OsStatus Create(uint32_t max_count, uint32_t initial_count, const SpinPolicy& spin)
+  {
+    return Base::QueryMut(OsStatus::Error,
+      [](auto* s, uint32_t m, uint32_t i, const SpinPolicy& p) -> decltype(s->CreateImpl(m, i, p)) {
+        return s->CreateImpl(m, i, p);
+      }, max_count, initial_count, spin);
+  }
+
+  /// Acquire against an absolute monotonic deadline.
+  OsStatus Acquire(const Deadline& deadline)
+  {
+    return Base::QueryOr(
+      [](auto* s, const Deadline& d) -> decltype(s->AcquireImpl(d)) { return s->AcquireImpl(d); },
+      [](auto* s, const Deadline& d) -> OsStatus { return s->Acquire(d.RemainingMs()); },
+      deadline);
+  }
+
   uint32_t GetCount() const
   {
     return Base::Query(uint32_t(0),
       [](const auto* s) -> decltype(s->GetCountImpl()) { return s->GetCountImpl(); });
   }
+
+  SpinStats GetSpinStats() const
+  {
+    return Base::Query(SpinStats{},
+      [](const auto* s) -> decltype(s->GetSpinStatsImpl()) { return s->GetSpinStatsImpl(); });
+  }
+
+  /// Descriptor that polls readable while the count is non-zero, so an
+  /// epoll/poll loop can wait on it next to sockets. Consume through the
+  /// normal API, never by reading the fd. -1 if the backend has none.
+  int GetNativeFd()
+  {
+    return Base::QueryMut(-1,
+      [](auto* s) -> decltype(s->GetNativeFdImpl()) { return s->GetNativeFdImpl(); });
+  }
 };
 
 } // namespace ifce::os
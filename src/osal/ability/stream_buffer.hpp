@@ -0,0 +1,199 @@
+#pragma once
+
+#include "osal/types.hpp"
+#include "osal/ability/dispatch.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ifce::os {
+
+/// Contiguous run of bytes inside a ring buffer
+struct ByteSpan
+{
+  uint8_t* data = nullptr;
+  size_t   size = 0;
+};
+
+/// Region of a ring buffer. `second` is only non-empty when the region
+/// wraps past the end of the ring, so in-place parsers see at most two runs.
+struct SpanPair
+{
+  ByteSpan first;
+  ByteSpan second;
+
+  size_t Size()  const { return first.size + second.size; }
+  bool   Empty() const { return Size() == 0; }
+
+  /// Bytes [offset, offset + len) of this region, clamped to its size.
+  SpanPair Sub(size_t offset, size_t len) const
+  {
+    SpanPair out;
+    if (offset >= Size()) return out;
+    if (len > Size() - offset) len = Size() - offset;
+
+    if (offset < first.size) {
+      size_t head = first.size - offset;
+      out.first  = { first.data + offset, head < len ? head : len };
+      out.second = { second.data, len - out.first.size };
+    } else {
+      out.first = { second.data + (offset - first.size), len };
+    }
+    if (out.second.size == 0) out.second.data = nullptr;
+    return out;
+  }
+
+  /// Copy `len` bytes starting at `offset` out of / into the region.
+  void CopyOut(size_t offset, void* dst, size_t len) const
+  {
+    SpanPair s = Sub(offset, len);
+    if (s.first.size)  std::memcpy(dst, s.first.data, s.first.size);
+    if (s.second.size) std::memcpy(static_cast<uint8_t*>(dst) + s.first.size, s.second.data, s.second.size);
+  }
+
+  void CopyIn(size_t offset, const void* src, size_t len) const
+  {
+    SpanPair s = Sub(offset, len);
+    if (s.first.size)  std::memcpy(s.first.data, src, s.first.size);
+    if (s.second.size) std::memcpy(s.second.data, static_cast<const uint8_t*>(src) + s.first.size, s.second.size);
+  }
+};
+
+/// Byte stream between one writer and one reader.
+///
+/// Send() waits up to `timeout_ms` for room for all `len` bytes, then
+/// writes as many as fit and returns that count. Receive() waits until at
+/// least the trigger level is buffered (or the timeout expires), then
+/// returns up to `max` bytes without further blocking.
+template <typename Derived>
+class StreamBufferAbility : protected ifce::DispatchBase<Derived>
+{
+  friend Derived;
+  using Base = ifce::DispatchBase<Derived>;
+
+public:
+  StreamBufferAbility()  = default;
+  ~StreamBufferAbility() = default;
+
+  StreamBufferAbility(const StreamBufferAbility&)            = delete;
+  StreamBufferAbility& operator=(const StreamBufferAbility&) = delete;
+
+  // --- Mandatory ---
+
+  OsStatus Create(size_t capacity, size_t trigger_level = 1)
+  {
+    return Base::Invoke(
+      [](auto* s, size_t c, size_t t) -> decltype(s->CreateImpl(c, t)) { return s->CreateImpl(c, t); },
+      capacity, trigger_level);
+  }
+
+  OsStatus Delete()
+  {
+    return Base::Invoke(
+      [](auto* s) -> decltype(s->DeleteImpl()) { return s->DeleteImpl(); });
+  }
+
+  size_t Send(const void* data, size_t len, uint32_t timeout_ms = WaitForever)
+  {
+    return Base::Invoke(
+      [](auto* s, const void* d, size_t n, uint32_t t) -> decltype(s->SendImpl(d, n, t)) {
+        return s->SendImpl(d, n, t);
+      }, data, len, timeout_ms);
+  }
+
+  size_t Receive(void* data, size_t max, uint32_t timeout_ms = WaitForever)
+  {
+    return Base::Invoke(
+      [](auto* s, void* d, size_t n, uint32_t t) -> decltype(s->ReceiveImpl(d, n, t)) {
+        return s->ReceiveImpl(d, n, t);
+      }, data, max, timeout_ms);
+  }
+
+  // --- Optional ---
+
+  size_t Send(const void* data, size_t len, const Deadline& deadline)
+  {
+    return Base::QueryOr(
+      [](auto* s, const void* d, size_t n, const Deadline& dl) -> decltype(s->SendImpl(d, n, dl)) {
+        return s->SendImpl(d, n, dl);
+      },
+      [](auto* s, const void* d, size_t n, const Deadline& dl) -> size_t {
+        return s->Send(d, n, dl.RemainingMs());
+      }, data, len, deadline);
+  }
+
+  size_t Receive(void* data, size_t max, const Deadline& deadline)
+  {
+    return Base::QueryOr(
+      [](auto* s, void* d, size_t n, const Deadline& dl) -> decltype(s->ReceiveImpl(d, n, dl)) {
+        return s->ReceiveImpl(d, n, dl);
+      },
+      [](auto* s, void* d, size_t n, const Deadline& dl) -> size_t {
+        return s->Receive(d, n, dl.RemainingMs());
+      }, data, max, deadline);
+  }
+
+  OsStatus SetTriggerLevel(size_t trigger_level)
+  {
+    return Base::QueryMut(OsStatus::Error,
+      [](auto* s, size_t t) -> decltype(s->SetTriggerLevelImpl(t)) { return s->SetTriggerLevelImpl(t); },
+      trigger_level);
+  }
+
+  /// Bytes buffered and bytes free.
+  size_t GetAvailable() const
+  {
+    return Base::Query(size_t(0),
+      [](const auto* s) -> decltype(s->GetAvailableImpl()) { return s->GetAvailableImpl(); });
+  }
+
+  size_t GetSpace() const
+  {
+    return Base::Query(size_t(0),
+      [](const auto* s) -> decltype(s->GetSpaceImpl()) { return s->GetSpaceImpl(); });
+  }
+
+  OsStatus Reset()
+  {
+    return Base::QueryMut(OsStatus::Error,
+      [](auto* s) -> decltype(s->ResetImpl()) { return s->ResetImpl(); });
+  }
+
+  // --- Optional: zero-copy span access ---
+  //
+  // Writer: Reserve() at least `min_bytes` of free space, fill any prefix of
+  // the returned spans, then Commit() the bytes written. Reader: Acquire()
+  // everything buffered once the trigger level is reached, parse it in
+  // place, then Release() the bytes consumed. An empty SpanPair means the
+  // wait timed out or the backend has no span access.
+
+  SpanPair Reserve(size_t min_bytes, uint32_t timeout_ms = WaitForever)
+  {
+    return Base::QueryMut(SpanPair{},
+      [](auto* s, size_t n, uint32_t t) -> decltype(s->ReserveImpl(n, t)) { return s->ReserveImpl(n, t); },
+      min_bytes, timeout_ms);
+  }
+
+  OsStatus Commit(size_t bytes)
+  {
+    return Base::QueryMut(OsStatus::Error,
+      [](auto* s, size_t n) -> decltype(s->CommitImpl(n)) { return s->CommitImpl(n); },
+      bytes);
+  }
+
+  SpanPair Acquire(uint32_t timeout_ms = WaitForever)
+  {
+    return Base::QueryMut(SpanPair{},
+      [](auto* s, uint32_t t) -> decltype(s->AcquireImpl(t)) { return s->AcquireImpl(t); },
+      timeout_ms);
+  }
+
+  OsStatus Release(size_t bytes)
+  {
+    return Base::QueryMut(OsStatus::Error,
+      [](auto* s, size_t n) -> decltype(s->ReleaseImpl(n)) { return s->ReleaseImpl(n); },
+      bytes);
+  }
+};
+
+} // namespace ifce::os
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "osal/ability/mailbox.hpp"
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+namespace ifce::os {
+
+/// Seqlock mailbox.
+///
+/// `seq_` is odd while a write is in flight and otherwise holds the version
+/// of the stored value (two per write). Readers copy the value word by word
+/// and retry if `seq_` moved underneath them, so they never hold up a
+/// writer; concurrent writers serialize on `seq_` itself. `taken_` records
+/// the last version consumed by Take, which is what makes the mailbox empty.
+///
+/// Shared by the hosted backends, which alias it as Mailbox<T> over their
+/// own detail::ParkingLot (`Lot`).
+template <typename T, typename Lot>
+class BasicMailbox : public MailboxAbility<BasicMailbox<T, Lot>, T>
+{
+  static_assert(std::is_trivially_copyable_v<T>,
+    "seqlock readers copy T bytewise; T must be trivially copyable");
+
+  friend class MailboxAbility<BasicMailbox<T, Lot>, T>;
+  friend class ifce::DispatchBase<BasicMailbox<T, Lot>>;
+
+public:
+  BasicMailbox()  = default;
+  ~BasicMailbox() { DeleteImpl(); }
+
+private:
+  using Word = uintptr_t;
+  static constexpr size_t kWords = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+
+  OsStatus CreateImpl()
+  {
+    if (initialized_) return OsStatus::Busy;
+    seq_.store(0);
+    taken_.store(0);
+    initialized_ = true;
+    return OsStatus::Ok;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    initialized_ = false;
+    return OsStatus::Ok;
+  }
+
+  OsStatus OverwriteImpl(const T& msg)
+  {
+    if (!initialized_) return OsStatus::Error;
+    Word buf[kWords] = {};
+    std::memcpy(buf, &msg, sizeof(T));
+
+    uint64_t s       = seq_.load(std::memory_order_relaxed);
+    uint32_t attempt = 0;
+    for (;;) {
+      if (s & 1) {
+        Lot::Backoff(attempt);
+        s = seq_.load(std::memory_order_relaxed);
+      } else if (seq_.compare_exchange_weak(s, s + 1, std::memory_order_acquire,
+                                            std::memory_order_relaxed)) {
+        break;
+      }
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < kWords; ++i)
+      words_[i].store(buf[i], std::memory_order_relaxed);
+    seq_.store(s + 2, std::memory_order_release);
+
+    lot_.NotifyAll();
+    return OsStatus::Ok;
+  }
+
+  OsStatus PeekImpl(T& msg, uint32_t timeout_ms) { return PeekImpl(msg, Deadline::FromTimeout(timeout_ms)); }
+
+  OsStatus PeekImpl(T& msg, const Deadline& deadline)
+  {
+    if (!initialized_) return OsStatus::Error;
+    for (;;) {
+      if (!lot_.Wait([this] { return !IsEmptyImpl(); }, deadline))
+        return OsStatus::Timeout;
+      if (Read(msg) > taken_.load(std::memory_order_acquire))
+        return OsStatus::Ok;
+    }
+  }
+
+  OsStatus TakeImpl(T& msg, uint32_t timeout_ms) { return TakeImpl(msg, Deadline::FromTimeout(timeout_ms)); }
+
+  OsStatus TakeImpl(T& msg, const Deadline& deadline)
+  {
+    if (!initialized_) return OsStatus::Error;
+    for (;;) {
+      if (!lot_.Wait([this] { return !IsEmptyImpl(); }, deadline))
+        return OsStatus::Timeout;
+      uint64_t version = Read(msg);
+      uint64_t taken   = taken_.load(std::memory_order_acquire);
+      while (taken < version) {
+        if (taken_.compare_exchange_weak(taken, version, std::memory_order_acq_rel))
+          return OsStatus::Ok;
+      }
+    }
+  }
+
+  bool IsEmptyImpl() const
+  {
+    uint64_t committed = seq_.load(std::memory_order_acquire) & ~uint64_t(1);
+    return committed <= taken_.load(std::memory_order_acquire);
+  }
+
+  /// Copies a consistent snapshot into `msg` and returns its version.
+  uint64_t Read(T& msg) const
+  {
+    Word     buf[kWords];
+    uint32_t attempt = 0;
+    for (;;) {
+      uint64_t s = seq_.load(std::memory_order_acquire);
+      if (!(s & 1)) {
+        for (size_t i = 0; i < kWords; ++i)
+          buf[i] = words_[i].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq_.load(std::memory_order_relaxed) == s) {
+          std::memcpy(&msg, buf, sizeof(T));
+          return s;
+        }
+      }
+      Lot::Backoff(attempt);
+    }
+  }
+
+private:
+  alignas(CacheLineSize) std::atomic<uint64_t> seq_ {0};
+  std::atomic<uint64_t>                        taken_ {0};
+  std::atomic<Word>                            words_[kWords] {};
+  Lot                                          lot_;
+  bool                                         initialized_ = false;
+};
+
+} // namespace ifce::os
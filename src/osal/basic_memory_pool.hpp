@@ -0,0 +1,250 @@
+#pragma once
+
+#include "osal/ability/memory_pool.hpp"
+#include "osal/free_list.hpp"
+#include <cstdint>
+#include <cstdlib>
+
+namespace ifce::os {
+
+namespace detail {
+
+/// Sync::Lot for backends that cannot park on an empty pool: Alloc only
+/// ever polls.
+struct NoParkingLot
+{
+  template <typename Pred, typename Timeout>
+  bool Wait(Pred&& ready, const Timeout&) { return ready(); }
+  void NotifyOne() {}
+  void NotifyAll() {}
+};
+
+} // namespace detail
+
+/// Fixed-block pool behind the hosted and FreeRTOS MemoryPool<T>.
+///
+/// Free blocks sit on an intrusive LIFO list under Sync::Mutex, or with
+/// PoolSync::LockFree on a tagged-index CAS stack (detail::IndexFreeList)
+/// that never takes the mutex. An empty pool parks Alloc on Sync::Lot
+/// until a Free hands a block back.
+///
+/// Each backend's MemoryPool<T> inherits the Impl methods privately. Sync
+/// supplies the Mutex (Open/Close/Lock/Unlock) and the Lot
+/// (Wait/NotifyOne/NotifyAll).
+template <typename T, typename Sync>
+class BasicMemoryPool
+{
+protected:
+  BasicMemoryPool()  = default;
+  ~BasicMemoryPool() { DeleteImpl(); }
+
+  BasicMemoryPool(const BasicMemoryPool&)            = delete;
+  BasicMemoryPool& operator=(const BasicMemoryPool&) = delete;
+
+  OsStatus CreateImpl(uint32_t block_count) { return CreateImpl(block_count, PoolSync::Mutex); }
+
+  OsStatus CreateImpl(uint32_t block_count, PoolSync sync)
+  {
+    if (pool_) return OsStatus::Busy;
+
+    size_t aligned_block = ((kBlockSize + kAlignment - 1) / kAlignment) * kAlignment;
+    pool_ = static_cast<uint8_t*>(std::malloc(aligned_block * block_count));
+    if (!pool_) return OsStatus::NoMemory;
+    if (sync == PoolSync::LockFree ? !lock_free_.Init(block_count) : !mutex_.Open()) {
+      std::free(pool_);
+      pool_ = nullptr;
+      return OsStatus::NoMemory;
+    }
+
+    block_count_ = block_count;
+    free_count_  = block_count;
+    block_size_  = aligned_block;
+    sync_        = sync;
+
+    // The lock-free list keeps its links beside the blocks
+    free_head_ = nullptr;
+    if (sync == PoolSync::LockFree) return OsStatus::Ok;
+    for (uint32_t i = 0; i < block_count; ++i) {
+      auto* node = reinterpret_cast<FreeNode*>(pool_ + i * aligned_block);
+      node->next = free_head_;
+      free_head_ = node;
+    }
+    return OsStatus::Ok;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    if (!pool_) return OsStatus::Ok;
+    if (sync_ == PoolSync::Mutex) mutex_.Close();
+    std::free(pool_);
+    lock_free_.Destroy();
+    pool_        = nullptr;
+    free_head_   = nullptr;
+    block_count_ = 0;
+    free_count_  = 0;
+    return OsStatus::Ok;
+  }
+
+  T* AllocImpl(uint32_t timeout_ms) { return Acquire(timeout_ms); }
+  T* AllocImpl(const Deadline& deadline) { return Acquire(deadline); }
+
+  template <typename Timeout>
+  T* Acquire(const Timeout& timeout)
+  {
+    if (!pool_) return nullptr;
+    T* result = nullptr;
+    available_.Wait([&] { return (result = TryAlloc()) != nullptr; }, timeout);
+    return result;
+  }
+
+  T* TryAlloc()
+  {
+    if (sync_ == PoolSync::LockFree) {
+      uint32_t idx = lock_free_.Pop();
+      return idx == detail::IndexFreeList::kNil ? nullptr : BlockAt(idx);
+    }
+    mutex_.Lock();
+    T* result = nullptr;
+    if (free_head_) {
+      result = reinterpret_cast<T*>(free_head_);
+      free_head_ = free_head_->next;
+      --free_count_;
+    }
+    mutex_.Unlock();
+    return result;
+  }
+
+  OsStatus FreeImpl(T* block)
+  {
+    uint32_t idx;
+    if (!pool_ || !IndexOf(block, idx)) return OsStatus::Error;
+    if (sync_ == PoolSync::LockFree) {
+      lock_free_.Push(idx);
+    } else {
+      mutex_.Lock();
+      auto* node = reinterpret_cast<FreeNode*>(block);
+      node->next = free_head_;
+      free_head_ = node;
+      ++free_count_;
+      mutex_.Unlock();
+    }
+    available_.NotifyOne();
+    return OsStatus::Ok;
+  }
+
+  uint32_t AllocBatchImpl(T** out, uint32_t count)
+  {
+    if (!pool_) return 0;
+    uint32_t n = 0;
+    if (sync_ == PoolSync::LockFree) {
+      for (uint32_t idx; n < count && (idx = lock_free_.Pop()) != detail::IndexFreeList::kNil; ++n)
+        out[n] = BlockAt(idx);
+      return n;
+    }
+
+    mutex_.Lock();
+    for (; n < count && free_head_; ++n) {
+      out[n] = reinterpret_cast<T*>(free_head_);
+      free_head_ = free_head_->next;
+    }
+    free_count_ -= n;
+    mutex_.Unlock();
+    return n;
+  }
+
+  uint32_t FreeBatchImpl(T* const* blocks, uint32_t count)
+  {
+    if (!pool_) return 0;
+    uint32_t accepted = 0;
+    if (sync_ == PoolSync::LockFree) {
+      // One CAS per chunk of indices
+      uint32_t chunk[32];
+      uint32_t n = 0;
+      for (uint32_t i = 0; i < count; ++i) {
+        if (!IndexOf(blocks[i], chunk[n])) continue;
+        ++accepted;
+        if (++n == 32) {
+          lock_free_.PushChain(chunk, n);
+          n = 0;
+        }
+      }
+      lock_free_.PushChain(chunk, n);
+      Released(accepted);
+      return accepted;
+    }
+
+    // Link the batch outside the lock, then splice it in
+    FreeNode* first = nullptr;
+    FreeNode* last  = nullptr;
+    for (uint32_t i = 0; i < count; ++i) {
+      uint32_t idx;
+      if (!IndexOf(blocks[i], idx)) continue;
+      auto* node = reinterpret_cast<FreeNode*>(blocks[i]);
+      node->next = first;
+      first = node;
+      if (!last) last = node;
+      ++accepted;
+    }
+    if (!first) return 0;
+
+    mutex_.Lock();
+    last->next = free_head_;
+    free_head_ = first;
+    free_count_ += accepted;
+    mutex_.Unlock();
+    Released(accepted);
+    return accepted;
+  }
+
+  void Released(uint32_t n)
+  {
+    if (n == 1)     available_.NotifyOne();
+    else if (n > 1) available_.NotifyAll();
+  }
+
+  uint32_t GetCountImpl() const { return block_count_; }
+  uint32_t GetFreeCountImpl() const
+  {
+    return sync_ == PoolSync::LockFree ? lock_free_.Size() : free_count_;
+  }
+
+  bool OwnsImpl(const T* block) const
+  {
+    uint32_t idx;
+    return IndexOf(block, idx);
+  }
+
+  T* BlockAt(uint32_t idx) const { return reinterpret_cast<T*>(pool_ + idx * block_size_); }
+
+  /// Maps a block pointer back to its index; false if it is not one of ours.
+  bool IndexOf(const T* block, uint32_t& idx) const
+  {
+    auto* ptr = reinterpret_cast<const uint8_t*>(block);
+    if (!ptr || ptr < pool_ || ptr >= pool_ + block_size_ * block_count_) return false;
+    size_t offset = static_cast<size_t>(ptr - pool_);
+    if (offset % block_size_ != 0) return false;
+    idx = static_cast<uint32_t>(offset / block_size_);
+    return true;
+  }
+
+private:
+  struct FreeNode { FreeNode* next; };
+
+  static constexpr size_t kBlockSize =
+    sizeof(T) > sizeof(FreeNode) ? sizeof(T) : sizeof(FreeNode);
+  static constexpr size_t kAlignment =
+    alignof(T) > alignof(FreeNode) ? alignof(T) : alignof(FreeNode);
+
+  typename Sync::Mutex mutex_;
+  uint8_t*             pool_        = nullptr;
+  FreeNode*            free_head_   = nullptr;
+  uint32_t             block_count_ = 0;
+  uint32_t             free_count_  = 0;
+  size_t               block_size_  = 0;
+  PoolSync             sync_        = PoolSync::Mutex;
+
+  detail::IndexFreeList lock_free_;
+  typename Sync::Lot    available_;
+};
+
+} // namespace ifce::os
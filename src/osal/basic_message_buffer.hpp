@@ -0,0 +1,131 @@
+#pragma once
+
+#include "osal/ability/message_buffer.hpp"
+#include <cstdint>
+
+namespace ifce::os {
+
+/// Length-prefixed framing over a StreamBuffer.
+///
+/// Every message is a 4-byte length followed by its payload, reserved and
+/// committed in one step, so the reader only ever sees whole messages and
+/// inherits the stream's lock-free single-writer / single-reader rules.
+///
+/// Shared by every backend whose StreamBuffer hands out SpanPairs; each
+/// aliases it as MessageBuffer over its own StreamBuffer (`Stream`).
+template <typename Stream>
+class BasicMessageBuffer : public MessageBufferAbility<BasicMessageBuffer<Stream>>
+{
+  friend class MessageBufferAbility<BasicMessageBuffer<Stream>>;
+  friend class ifce::DispatchBase<BasicMessageBuffer<Stream>>;
+
+public:
+  BasicMessageBuffer()  = default;
+  ~BasicMessageBuffer() { DeleteImpl(); }
+
+private:
+  using Length = uint32_t;
+  static constexpr size_t kHeader = sizeof(Length);
+
+  OsStatus CreateImpl(size_t capacity)
+  {
+    if (capacity <= kHeader) return OsStatus::Error;
+    OsStatus rc = stream_.Create(capacity, 1);
+    if (rc == OsStatus::Ok) capacity_ = capacity;
+    return rc;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    reserved_     = {};
+    acquired_len_ = 0;
+    capacity_     = 0;
+    return stream_.Delete();
+  }
+
+  size_t SendImpl(const void* data, size_t len, uint32_t timeout_ms)
+  {
+    if (len == 0 || len > MaxLength()) return 0;
+    SpanPair s = stream_.Reserve(kHeader + len, timeout_ms);
+    if (s.Size() < kHeader + len) return 0;
+    Length header = static_cast<Length>(len);
+    s.CopyIn(0, &header, kHeader);
+    s.CopyIn(kHeader, data, len);
+    stream_.Commit(kHeader + len);
+    return len;
+  }
+
+  size_t ReceiveImpl(void* data, size_t max, uint32_t timeout_ms)
+  {
+    SpanPair s   = stream_.Acquire(timeout_ms);
+    size_t   len = LengthOf(s);
+    if (len == 0 || len > max) return 0;
+    s.CopyOut(kHeader, data, len);
+    stream_.Release(kHeader + len);
+    return len;
+  }
+
+  /// Reader side only.
+  size_t GetNextLengthImpl() const { return LengthOf(stream_.Acquire(0)); }
+
+  size_t GetSpaceImpl() const { return stream_.GetSpace(); }
+  bool   IsEmptyImpl()  const { return stream_.GetAvailable() == 0; }
+
+  OsStatus ResetImpl()
+  {
+    acquired_len_ = 0;
+    return stream_.Reset();
+  }
+
+  SpanPair ReserveImpl(size_t max_len, uint32_t timeout_ms)
+  {
+    if (max_len == 0 || max_len > MaxLength()) return {};
+    SpanPair s = stream_.Reserve(kHeader + max_len, timeout_ms);
+    if (s.Size() < kHeader + max_len) return {};
+    reserved_ = s.Sub(0, kHeader + max_len);
+    return reserved_.Sub(kHeader, max_len);
+  }
+
+  OsStatus CommitImpl(size_t len)
+  {
+    if (len == 0 || kHeader + len > reserved_.Size()) return OsStatus::Error;
+    Length header = static_cast<Length>(len);
+    reserved_.CopyIn(0, &header, kHeader);
+    reserved_ = {};
+    return stream_.Commit(kHeader + len);
+  }
+
+  SpanPair AcquireImpl(uint32_t timeout_ms)
+  {
+    SpanPair s    = stream_.Acquire(timeout_ms);
+    acquired_len_ = LengthOf(s);
+    return s.Sub(kHeader, acquired_len_);
+  }
+
+  OsStatus ReleaseImpl()
+  {
+    if (acquired_len_ == 0) return OsStatus::Error;
+    OsStatus rc = stream_.Release(kHeader + acquired_len_);
+    acquired_len_ = 0;
+    return rc;
+  }
+
+  size_t MaxLength() const { return capacity_ ? capacity_ - kHeader : 0; }
+
+  static size_t LengthOf(const SpanPair& s)
+  {
+    if (s.Size() < kHeader) return 0;
+    Length len = 0;
+    s.CopyOut(0, &len, kHeader);
+    return len;
+  }
+
+private:
+  // Acquire(0) is the reader peeking at its own side; it changes nothing
+  mutable Stream stream_;
+  size_t         capacity_     = 0;
+  SpanPair       reserved_;          // writer side
+  size_t         acquired_len_ = 0;  // reader side
+};
+
+} // namespace ifce::os
@@ -0,0 +1,765 @@
+#pragma once
+
+#include "osal/ability/message_queue.hpp"
+#include "osal/ability/queue_set.hpp"
+#include "osal/queue_stats.hpp"
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ifce::os {
+
+namespace detail {
+
+/// Sync::ReadyFd for backends with no pollable descriptor; a queue built
+/// on it has no GetNativeFd().
+struct NoReadyFd
+{
+  template <typename Pred> void Refresh(Pred&&) {}
+  void Close() {}
+};
+
+} // namespace detail
+
+/// Bounded priority queue over a contiguous block of preallocated slots.
+///
+/// Queued slots are threaded onto one intrusive FIFO list per priority
+/// level; a bitmap of non-empty levels makes Get pick the highest level in
+/// constant time. Free slots sit on a LIFO list so recently used (cache-hot)
+/// slots are reused first. Loaned slots (Reserve/Acquire) belong to no list
+/// until they are committed or released, so loans may be returned in any
+/// order without holding up the rest of the queue.
+///
+/// Shared by the hosted backends, which alias it as MessageQueue<T> over
+/// their own detail::QueueSync (`Sync`). Sync supplies the Mutex
+/// (Lock/Unlock) and Cond (Wait/Signal/Broadcast, called with the mutex
+/// held) the slot lists are guarded by, plus the backend's Spinner,
+/// ReadyFd and QueueSet.
+template <typename T, typename Sync>
+class BasicMessageQueue : public MessageQueueAbility<BasicMessageQueue<T, Sync>, T>
+{
+  friend class MessageQueueAbility<BasicMessageQueue<T, Sync>, T>;
+  friend class ifce::DispatchBase<BasicMessageQueue<T, Sync>>;
+  friend typename Sync::QueueSet;
+  template <typename, uint32_t> friend class StaticMessageQueue;
+
+public:
+  BasicMessageQueue()  = default;
+  ~BasicMessageQueue() { DeleteImpl(); }
+
+  /// Priorities at or above this value share the highest level.
+  static constexpr uint32_t kPriorityLevels = 8;
+
+private:
+  enum class SlotState : uint8_t { Free, Queued, Reserved, Acquired };
+
+  using Stats    = detail::QueueStatsRecorder<detail::SteadyMicros>;
+  using Counter  = std::atomic<uint32_t>;
+  using Mutex    = typename Sync::Mutex;
+  using Cond     = typename Sync::Cond;
+  using QueueSet = typename Sync::QueueSet;
+
+  struct Slot
+  {
+    alignas(T) unsigned char data[sizeof(T)];
+    uint32_t     next;
+    uint32_t     prev;   // level list only, so DropOldest can unlink mid-list
+    uint32_t     seq;    // arrival order, for DropOldest
+    SlotState    state;
+    Stats::Stamp stamp;
+  };
+
+  static constexpr uint32_t kNil = 0xFFFFFFFFu;
+
+  /// A level reads [PutToFront run, newest first][Put run, oldest first];
+  /// `split` is the last slot of the front run, i.e. its oldest.
+  struct Level
+  {
+    uint32_t head  = kNil;
+    uint32_t tail  = kNil;
+    uint32_t split = kNil;
+  };
+
+  OsStatus CreateImpl(uint32_t capacity) { return CreateImpl(capacity, Allocator{}, SpinPolicy{}); }
+
+  OsStatus CreateImpl(uint32_t capacity, OverflowPolicy policy)
+  {
+    OsStatus rc = CreateImpl(capacity);
+    if (rc == OsStatus::Ok) policy_ = policy;
+    return rc;
+  }
+
+  /// The whole slot block is one cache-aligned allocation taken at Create
+  /// time, so the steady state never touches the heap.
+  OsStatus CreateImpl(uint32_t capacity, const Allocator& allocator, const SpinPolicy& spin)
+  {
+    if (initialized_) return OsStatus::Busy;
+    void* mem = allocator.Allocate(StorageSize(capacity), kStorageAlign);
+    if (!mem) return OsStatus::NoMemory;
+    slots_ = static_cast<Slot*>(mem);
+    for (uint32_t i = 0; i < capacity; ++i) {
+      Slot* slot  = new (&slots_[i]) Slot;
+      slot->next  = (i + 1 < capacity) ? i + 1 : kNil;
+      slot->state = SlotState::Free;
+    }
+
+    spinner_.Configure(spin);
+    allocator_ = allocator;
+    policy_    = OverflowPolicy::Block;
+    capacity_  = capacity;
+    free_      = capacity ? 0 : kNil;
+    used_      = 0;
+    count_     = 0;
+    used_hint_.store(0, std::memory_order_relaxed);
+    count_hint_.store(0, std::memory_order_relaxed);
+    ready_     = 0;
+    for (Level& level : levels_) level = Level{};
+    rejected_.store(0, std::memory_order_relaxed);
+    evicted_.store(0, std::memory_order_relaxed);
+    initialized_ = true;
+    return OsStatus::Ok;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    if (!initialized_) return OsStatus::Ok;
+    // Leave the set first, so its ring keeps no events naming freed storage
+    if (queue_set_) queue_set_->Detach(*this);
+    ready_fd_.Close();
+    Locked lock(*this);
+    for (uint32_t i = 0; i < capacity_; ++i) {
+      if (slots_[i].state != SlotState::Free)
+        At(i)->~T();
+    }
+    allocator_.Deallocate(slots_, StorageSize(capacity_), kStorageAlign);
+    slots_       = nullptr;
+    initialized_ = false;
+    return OsStatus::Ok;
+  }
+
+  OsStatus PutImpl(const T& msg, uint32_t timeout_ms) { return EmplaceImpl(timeout_ms, msg); }
+  OsStatus PutImpl(T&& msg, uint32_t timeout_ms) { return EmplaceImpl(timeout_ms, std::move(msg)); }
+  OsStatus PutImpl(const T& msg, const Deadline& deadline) { return PushWait(0, false, deadline, msg); }
+  OsStatus PutImpl(T&& msg, const Deadline& deadline) { return PushWait(0, false, deadline, std::move(msg)); }
+
+  OsStatus PutImpl(const T& msg, uint8_t priority, uint32_t timeout_ms)
+  {
+    return PushWait(LevelOf(priority), false, Deadline::FromTimeout(timeout_ms), msg);
+  }
+
+  OsStatus PutImpl(T&& msg, uint8_t priority, uint32_t timeout_ms)
+  {
+    return PushWait(LevelOf(priority), false, Deadline::FromTimeout(timeout_ms), std::move(msg));
+  }
+
+  template <typename... Args>
+  OsStatus EmplaceImpl(uint32_t timeout_ms, Args&&... args)
+  {
+    return PushWait(0, false, Deadline::FromTimeout(timeout_ms), std::forward<Args>(args)...);
+  }
+
+  OsStatus GetImpl(T& msg, uint32_t timeout_ms) { return GetImpl(msg, Deadline::FromTimeout(timeout_ms)); }
+
+  OsStatus GetImpl(T& msg, const Deadline& deadline)
+  {
+    if (!initialized_) return OsStatus::Error;
+    Locked lock(*this);
+
+    if (!WaitLocked(cond_not_empty_, [this] { return count_ > 0; }, deadline)) {
+      stats_.GetTimeout();
+      return OsStatus::Timeout;
+    }
+
+    PopLocked(msg);
+    Signal(cond_not_full_);
+    Drained();
+    return OsStatus::Ok;
+  }
+
+  /// Jumps ahead of everything queued, including higher priorities.
+  OsStatus PutToFrontImpl(const T& msg, uint32_t timeout_ms)
+  {
+    return PushWait(kPriorityLevels - 1, true, Deadline::FromTimeout(timeout_ms), msg);
+  }
+
+  OsStatus PutToFrontImpl(T&& msg, uint32_t timeout_ms)
+  {
+    return PushWait(kPriorityLevels - 1, true, Deadline::FromTimeout(timeout_ms), std::move(msg));
+  }
+
+  uint32_t PutManyImpl(const T* msgs, uint32_t count, uint32_t timeout_ms)
+  {
+    if (!initialized_ || !msgs) return 0;
+    Deadline deadline = Deadline::FromTimeout(timeout_ms);
+    Locked lock(*this);
+
+    uint32_t done = 0;
+    while (done < count) {
+      {
+        // One wakeup per burst, not per message; still sent if a copy throws
+        struct Burst
+        {
+          BasicMessageQueue* queue;
+          uint32_t           n;
+          ~Burst() { queue->Published(n); }
+        } burst{this, 0};
+        for (; done < count && !Full(); ++done, ++burst.n)
+          PushLocked(0, false, msgs[done]);
+      }
+
+      if (done == count) break;
+      if (!MakeRoomLocked(0, deadline)) {
+        stats_.PutTimeout();
+        break;
+      }
+    }
+
+    return done;
+  }
+
+  uint32_t GetManyImpl(T* msgs, uint32_t max, uint32_t timeout_ms)
+  {
+    if (!initialized_ || !msgs || max == 0) return 0;
+    Deadline deadline = Deadline::FromTimeout(timeout_ms);
+    Locked lock(*this);
+
+    if (!WaitLocked(cond_not_empty_, [this] { return count_ > 0; }, deadline)) {
+      stats_.GetTimeout();
+      return 0;
+    }
+
+    // Wakes producers for the slots already freed, even if a move throws
+    struct Drain
+    {
+      BasicMessageQueue* queue;
+      uint32_t           n;
+      ~Drain()
+      {
+        if (n == 1)     Signal(queue->cond_not_full_);
+        else if (n > 1) Broadcast(queue->cond_not_full_);
+        queue->Drained();
+      }
+    } drain{this, 0};
+    while (drain.n < max && count_ > 0) {
+      PopLocked(msgs[drain.n]);
+      ++drain.n;
+    }
+    return drain.n;
+  }
+
+  /// Detaches up to `max` messages under one lock, runs `fn` on them in
+  /// place with the lock dropped (so producers keep going and `fn` may
+  /// Put back into this queue), then frees the whole batch under a second
+  /// lock with a single wake-up for blocked producers.
+  template <typename Fn>
+  uint32_t ConsumeImpl(Fn& fn, uint32_t max, uint32_t timeout_ms)
+  {
+    if (!initialized_ || max == 0) return 0;
+    Deadline deadline = Deadline::FromTimeout(timeout_ms);
+    uint32_t first = kNil;
+    uint32_t n     = 0;
+    {
+      Locked lock(*this);
+
+      if (!WaitLocked(cond_not_empty_, [this] { return count_ > 0; }, deadline)) {
+        stats_.GetTimeout();
+        return 0;
+      }
+
+      // Chain the batch through `next` as acquired slots; no list owns them
+      uint32_t last = kNil;
+      for (; n < max && count_ > 0; ++n) {
+        uint32_t idx = Unlink();
+        stats_.Delivered(slots_[idx].stamp);
+        slots_[idx].state = SlotState::Acquired;
+        slots_[idx].next  = kNil;
+        if (last == kNil) first = idx;
+        else              slots_[last].next = idx;
+        last = idx;
+      }
+      Drained();
+    }
+
+    // Hand the batch back even if `fn` throws
+    struct BatchGuard
+    {
+      BasicMessageQueue* queue;
+      uint32_t      first;
+      uint32_t      n;
+      ~BatchGuard() { queue->ReleaseBatch(first, n); }
+    } guard{this, first, n};
+
+    for (uint32_t idx = first; idx != kNil; idx = slots_[idx].next)
+      fn(*At(idx));
+    return n;
+  }
+
+  /// Destroys and frees a batch chained by ConsumeImpl, then wakes producers.
+  void ReleaseBatch(uint32_t first, uint32_t n)
+  {
+    Locked lock(*this);
+    for (uint32_t idx = first; idx != kNil;) {
+      uint32_t next = slots_[idx].next;
+      At(idx)->~T();
+      PutFree(idx);
+      idx = next;
+    }
+    if (n == 1) Signal(cond_not_full_);
+    else        Broadcast(cond_not_full_);
+  }
+
+  // --- Zero-copy loans ---
+
+  T* ReserveImpl(uint32_t timeout_ms)
+  {
+    if (!initialized_) return nullptr;
+    Deadline deadline = Deadline::FromTimeout(timeout_ms);
+    Locked lock(*this);
+
+    if (!MakeRoomLocked(0, deadline)) {
+      stats_.PutTimeout();
+      return nullptr;
+    }
+
+    // Construct before claiming the slot, so a throwing T leaves it free
+    T* item = new (At(free_)) T;
+    uint32_t idx = TakeFree();
+    slots_[idx].state = SlotState::Reserved;
+    return item;
+  }
+
+  /// Publishes at priority 0, in commit order.
+  OsStatus CommitImpl(T* item)
+  {
+    if (!initialized_) return OsStatus::Error;
+    Locked lock(*this);
+
+    uint32_t idx;
+    if (!IndexOf(item, &idx) || slots_[idx].state != SlotState::Reserved)
+      return OsStatus::Error;
+
+    Link(idx, 0, false);
+    Published(1);
+    return OsStatus::Ok;
+  }
+
+  T* AcquireImpl(uint32_t timeout_ms)
+  {
+    if (!initialized_) return nullptr;
+    Deadline deadline = Deadline::FromTimeout(timeout_ms);
+    Locked lock(*this);
+
+    if (!WaitLocked(cond_not_empty_, [this] { return count_ > 0; }, deadline)) {
+      stats_.GetTimeout();
+      return nullptr;
+    }
+
+    uint32_t idx = Unlink();
+    stats_.Delivered(slots_[idx].stamp);
+    slots_[idx].state = SlotState::Acquired;
+    Drained();
+    return At(idx);
+  }
+
+  OsStatus ReleaseImpl(T* item)
+  {
+    if (!initialized_) return OsStatus::Error;
+    Locked lock(*this);
+
+    uint32_t idx;
+    if (!IndexOf(item, &idx) || slots_[idx].state != SlotState::Acquired)
+      return OsStatus::Error;
+
+    item->~T();
+    PutFree(idx);
+    Signal(cond_not_full_);
+    return OsStatus::Ok;
+  }
+
+  /// Unlocked snapshot; may be stale by the time the caller acts on it.
+  uint32_t GetCountImpl() const
+  {
+    return count_hint_.load(std::memory_order_relaxed);
+  }
+
+  uint32_t GetCapacityImpl() const { return capacity_; }
+
+  SpinStats GetSpinStatsImpl() const { return spinner_.Stats(); }
+
+  QueueStats GetStatsImpl() const { return stats_.Snapshot(); }
+
+  DropStats GetDropStatsImpl() const
+  {
+    return { rejected_.load(std::memory_order_relaxed), evicted_.load(std::memory_order_relaxed) };
+  }
+
+  /// Discards queued messages. Outstanding loans are left untouched.
+  OsStatus ResetImpl()
+  {
+    if (!initialized_) return OsStatus::Error;
+    Locked lock(*this);
+    while (count_ > 0) {
+      uint32_t idx = Unlink();
+      At(idx)->~T();
+      PutFree(idx);
+      if (queue_set_) queue_set_->Retract(this);
+    }
+    Broadcast(cond_not_full_);
+    Drained();
+    return OsStatus::Ok;
+  }
+
+  template <typename S = Sync,
+            typename = std::enable_if_t<!std::is_same_v<typename S::ReadyFd, detail::NoReadyFd>>>
+  int GetNativeFdImpl()
+  {
+    if (!initialized_) return -1;
+    Locked lock(*this);
+    return ready_fd_.Open([this] { return count_ > 0; });
+  }
+
+  template <typename... Args>
+  OsStatus PushWait(uint32_t level, bool front, const Deadline& deadline, Args&&... args)
+  {
+    if (!initialized_) return OsStatus::Error;
+    Locked lock(*this);
+
+    if (!MakeRoomLocked(level, deadline)) {
+      stats_.PutTimeout();
+      return OsStatus::Timeout;
+    }
+
+    PushLocked(level, front, std::forward<Args>(args)...);
+    Published(1);
+    return OsStatus::Ok;
+  }
+
+  // --- Slot helpers (caller holds mutex_) ---
+
+  static constexpr size_t kStorageAlign =
+    alignof(Slot) > CacheLineSize ? alignof(Slot) : CacheLineSize;
+
+  static constexpr size_t StorageSize(uint32_t capacity)
+  {
+    return sizeof(Slot) * (capacity ? capacity : 1);
+  }
+
+  static uint32_t LevelOf(uint8_t priority)
+  {
+    return (priority < kPriorityLevels) ? priority : kPriorityLevels - 1;
+  }
+
+  bool Full() const { return used_ >= capacity_; }
+
+  T* At(uint32_t idx) { return std::launder(reinterpret_cast<T*>(slots_[idx].data)); }
+
+  bool IndexOf(const T* item, uint32_t* idx) const
+  {
+    auto* p    = reinterpret_cast<const unsigned char*>(item);
+    auto* base = reinterpret_cast<const unsigned char*>(slots_);
+    if (p < base || p >= base + sizeof(Slot) * capacity_) return false;
+    size_t off = static_cast<size_t>(p - base);
+    if (off % sizeof(Slot) != 0) return false;
+    *idx = static_cast<uint32_t>(off / sizeof(Slot));
+    return true;
+  }
+
+  uint32_t TakeFree()
+  {
+    uint32_t idx = free_;
+    free_ = slots_[idx].next;
+    used_hint_.store(++used_, std::memory_order_relaxed);
+    return idx;
+  }
+
+  void PutFree(uint32_t idx)
+  {
+    slots_[idx].state = SlotState::Free;
+    slots_[idx].next  = free_;
+    free_ = idx;
+    used_hint_.store(--used_, std::memory_order_relaxed);
+  }
+
+  void Link(uint32_t idx, uint32_t level, bool front)
+  {
+    Level& l = levels_[level];
+    Slot&  s = slots_[idx];
+    s.state = SlotState::Queued;
+    s.seq   = next_seq_++;
+    if (l.head == kNil) {
+      s.next = s.prev = kNil;
+      l.head = l.tail = idx;
+      ready_ |= 1u << level;
+    } else if (front) {
+      s.prev = kNil;
+      s.next = l.head;
+      slots_[l.head].prev = idx;
+      l.head = idx;
+    } else {
+      s.prev = l.tail;
+      s.next = kNil;
+      slots_[l.tail].next = idx;
+      l.tail = idx;
+    }
+    if (front && l.split == kNil) l.split = idx;
+    count_hint_.store(++count_, std::memory_order_relaxed);
+    stats_.MarkPut(s.stamp);
+    stats_.Put(count_);
+  }
+
+  uint32_t HighestLevel() const
+  {
+    uint32_t level = kPriorityLevels - 1;
+    while (!(ready_ & (1u << level))) --level;
+    return level;
+  }
+
+  /// Detaches the head of the highest non-empty level.
+  uint32_t Unlink() { return UnlinkFrom(HighestLevel()); }
+
+  bool Older(uint32_t a, uint32_t b) const
+  {
+    return static_cast<int32_t>(slots_[a].seq - slots_[b].seq) < 0;
+  }
+
+  /// Earliest-queued slot of a non-empty level: the oldest of its front run
+  /// or the first of its FIFO run, whichever arrived first.
+  uint32_t OldestIn(uint32_t level) const
+  {
+    const Level& l = levels_[level];
+    if (l.split == kNil) return l.head;
+    uint32_t fifo = slots_[l.split].next;
+    return (fifo == kNil || Older(l.split, fifo)) ? l.split : fifo;
+  }
+
+  /// Earliest-queued slot across all levels; its level goes to `*level`.
+  uint32_t Oldest(uint32_t* level) const
+  {
+    uint32_t best = kNil;
+    for (uint32_t lv = 0; lv < kPriorityLevels; ++lv) {
+      if (!(ready_ & (1u << lv))) continue;
+      uint32_t idx = OldestIn(lv);
+      if (best == kNil || Older(idx, best)) {
+        best   = idx;
+        *level = lv;
+      }
+    }
+    return best;
+  }
+
+  uint32_t LowestLevel() const
+  {
+    uint32_t level = 0;
+    while (!(ready_ & (1u << level))) ++level;
+    return level;
+  }
+
+  uint32_t UnlinkFrom(uint32_t level) { return UnlinkSlot(level, levels_[level].head); }
+
+  uint32_t UnlinkSlot(uint32_t level, uint32_t idx)
+  {
+    Level& l = levels_[level];
+    Slot&  s = slots_[idx];
+    // Everything ahead of the split is front run too, so its prev takes over
+    if (idx == l.split) l.split = s.prev;
+    if (s.prev == kNil) l.head = s.next;
+    else                slots_[s.prev].next = s.next;
+    if (s.next == kNil) l.tail = s.prev;
+    else                slots_[s.next].prev = s.prev;
+    if (l.head == kNil) ready_ &= ~(1u << level);
+    count_hint_.store(--count_, std::memory_order_relaxed);
+    return idx;
+  }
+
+  /// Constructs in the first free slot before claiming it, and moves the
+  /// head out before detaching it, so a T that throws leaves the lists as
+  /// they were.
+  template <typename... Args>
+  void PushLocked(uint32_t level, bool front, Args&&... args)
+  {
+    new (At(free_)) T(std::forward<Args>(args)...);
+    Link(TakeFree(), level, front);
+  }
+
+  void PopLocked(T& msg)
+  {
+    T* item = At(levels_[HighestLevel()].head);
+    msg = std::move(*item);
+    uint32_t idx = Unlink();
+    stats_.Delivered(slots_[idx].stamp);
+    item->~T();
+    PutFree(idx);
+  }
+
+  // --- Synchronization ---
+
+  void Lock()   { mutex_.Lock(); }
+  void Unlock() { mutex_.Unlock(); }
+
+  /// Holds mutex_ for a scope, so a T constructor or assignment that
+  /// throws cannot leave the queue locked.
+  class Locked
+  {
+  public:
+    explicit Locked(BasicMessageQueue& queue) : queue_(queue) { queue_.Lock(); }
+    ~Locked() { queue_.Unlock(); }
+
+    Locked(const Locked&)            = delete;
+    Locked& operator=(const Locked&) = delete;
+
+  private:
+    BasicMessageQueue& queue_;
+  };
+  static void Signal(Cond& cond)    { cond.Signal(); }
+  static void Broadcast(Cond& cond) { cond.Broadcast(); }
+  bool WaitOn(Cond& cond, const Deadline& deadline) { return cond.Wait(mutex_, deadline); }
+
+  /// QueueSet::Add/Remove attach and detach under mutex_, so a concurrent
+  /// Put posts to the set either fully or not at all.
+  void BindQueueSet(QueueSet* set)
+  {
+    Locked lock(*this);
+    queue_set_ = set;
+  }
+
+  // --- Waiting (caller holds mutex_) ---
+
+  /// Wake consumers, and the owning QueueSet once per item, for `n` new items.
+  void Published(uint32_t n)
+  {
+    if (n == 1)     Signal(cond_not_empty_);
+    else if (n > 1) Broadcast(cond_not_empty_);
+    if (queue_set_)
+      for (uint32_t i = 0; i < n; ++i)
+        queue_set_->Post(this);
+    if (n) ready_fd_.Refresh([this] { return count_ > 0; });
+  }
+
+  /// Counterpart of Published() for consumers: un-signal the native fd
+  /// once the queue runs empty.
+  void Drained()
+  {
+    ready_fd_.Refresh([this] { return count_ > 0; });
+  }
+
+  template <typename Pred>
+  bool WaitLocked(Cond& cond, Pred ready, const Deadline& deadline)
+  {
+    if (ready()) return true;
+    if (deadline.Expired()) return false;
+    int64_t since = stats_.Now();
+    bool ok = SpinLocked(cond, ready) || ParkLocked(cond, ready, deadline);
+    stats_.Blocked(&cond == &cond_not_full_, stats_.Now() - since);
+    return ok;
+  }
+
+  template <typename Pred>
+  bool ParkLocked(Cond& cond, Pred& ready, const Deadline& deadline)
+  {
+    spinner_.Parked();
+
+    // SpinLocked re-took the lock after its last check; re-test before sleeping
+    while (!ready()) {
+      if (!WaitOn(cond, deadline))
+        return ready();
+    }
+    return true;
+  }
+
+  /// Frees a slot for a message at `level` under the overflow policy.
+  /// Lossy policies never wait: they evict a queued message or reject the
+  /// new one at once. Slots out on loan are never evicted.
+  bool MakeRoomLocked(uint32_t level, const Deadline& deadline)
+  {
+    if (!Full()) return true;
+    switch (policy_) {
+      case OverflowPolicy::Block:
+        return WaitLocked(cond_not_full_, [this] { return !Full(); }, deadline);
+
+      case OverflowPolicy::DropOldest:
+        if (count_ > 0) {
+          uint32_t oldest_level = 0;
+          uint32_t oldest       = Oldest(&oldest_level);
+          return Evict(UnlinkSlot(oldest_level, oldest));
+        }
+        break;
+
+      case OverflowPolicy::EvictLowest:
+        if (count_ > 0) {
+          uint32_t lowest = LowestLevel();
+          if (lowest < level) return Evict(UnlinkFrom(lowest));
+        }
+        break;
+
+      case OverflowPolicy::DropNewest:
+        break;
+    }
+    rejected_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  bool Evict(uint32_t idx)
+  {
+    At(idx)->~T();
+    PutFree(idx);
+    // The victim's set event would otherwise outlive it
+    if (queue_set_) queue_set_->Retract(this);
+    evicted_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /// Lock-free guess at whether a waiter on `cond` could proceed, from the
+  /// relaxed mirrors of used_/count_. Only ever a hint: the caller re-tests
+  /// under the lock.
+  bool LooksReady(const Cond& cond) const
+  {
+    if (&cond == &cond_not_full_)
+      return used_hint_.load(std::memory_order_relaxed) < capacity_;
+    return count_hint_.load(std::memory_order_relaxed) > 0;
+  }
+
+  /// Spins on LooksReady() without the lock, taking it only to confirm a
+  /// likely hit; holds it again on return.
+  template <typename Pred>
+  bool SpinLocked(const Cond& cond, Pred& ready)
+  {
+    Unlock();
+    bool ok = spinner_.Spin([&] {
+      if (!LooksReady(cond)) return false;
+      Lock();
+      if (ready()) return true;
+      Unlock();
+      return false;
+    });
+    if (!ok) Lock();
+    return ok;
+  }
+
+private:
+  Mutex                  mutex_;
+  Cond                   cond_not_empty_;
+  Cond                   cond_not_full_;
+  typename Sync::Spinner spinner_;
+  Stats                  stats_;
+  typename Sync::ReadyFd ready_fd_;
+  QueueSet*              queue_set_   = nullptr;
+  detail::QueueSetHook   set_hook_;
+  Allocator              allocator_;
+  OverflowPolicy         policy_      = OverflowPolicy::Block;
+  Counter                rejected_    {0};
+  Counter                evicted_     {0};
+  Slot*                  slots_       = nullptr;
+  Level                  levels_[kPriorityLevels];
+  uint32_t               ready_       = 0;
+  uint32_t               next_seq_    = 0;
+  uint32_t               free_        = kNil;
+  uint32_t               capacity_    = 0;
+  uint32_t               used_        = 0;
+  uint32_t               count_       = 0;
+  Counter                used_hint_   {0};  // relaxed copies for lock-free spinning and GetCount
+  Counter                count_hint_  {0};
+  bool                   initialized_ = false;
+};
+
+} // namespace ifce::os
@@ -0,0 +1,210 @@
+#pragma once
+
+#include "osal/ability/message_queue.hpp"
+#include <atomic>
+#include <new>
+#include <utility>
+
+namespace ifce::os {
+
+/// Bounded multi-producer / multi-consumer queue (Vyukov-style).
+///
+/// Every slot carries a sequence number that tells producers and consumers
+/// whether it is free for the current lap, so Put/Get claim a slot with a
+/// single CAS on their own cursor and never share a lock. Threads park only
+/// when the ring is full (producers) or empty (consumers).
+///
+/// The capacity is rounded up to a power of two.
+///
+/// Shared by the hosted backends, which alias it as MpmcMessageQueue<T>
+/// over their own detail::ParkingLot (`Lot`).
+template <typename T, typename Lot>
+class BasicMpmcMessageQueue : public MessageQueueAbility<BasicMpmcMessageQueue<T, Lot>, T>
+{
+  friend class MessageQueueAbility<BasicMpmcMessageQueue<T, Lot>, T>;
+  friend class ifce::DispatchBase<BasicMpmcMessageQueue<T, Lot>>;
+
+public:
+  BasicMpmcMessageQueue()  = default;
+  ~BasicMpmcMessageQueue() { DeleteImpl(); }
+
+private:
+  struct Cell
+  {
+    std::atomic<uint32_t> seq;
+    alignas(T) unsigned char data[sizeof(T)];
+  };
+
+  static constexpr size_t kStorageAlign =
+    alignof(Cell) > CacheLineSize ? alignof(Cell) : CacheLineSize;
+
+  OsStatus CreateImpl(uint32_t capacity) { return CreateImpl(capacity, Allocator{}, SpinPolicy{}); }
+
+  OsStatus CreateImpl(uint32_t capacity, const Allocator& allocator, const SpinPolicy& spin)
+  {
+    if (cells_) return OsStatus::Busy;
+    if (capacity == 0 || capacity > 0x80000000u) return OsStatus::Error;
+
+    uint32_t size = NextPowerOfTwo(capacity);
+    void* mem = allocator.Allocate(sizeof(Cell) * size, kStorageAlign);
+    if (!mem) return OsStatus::NoMemory;
+    cells_ = static_cast<Cell*>(mem);
+
+    for (uint32_t i = 0; i < size; ++i)
+      (new (&cells_[i]) Cell)->seq.store(i, std::memory_order_relaxed);
+    not_empty_.Configure(spin);
+    not_full_.Configure(spin);
+    allocator_ = allocator;
+    mask_      = size - 1;
+    enqueue_pos_.store(0, std::memory_order_relaxed);
+    dequeue_pos_.store(0, std::memory_order_release);
+    return OsStatus::Ok;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    if (!cells_) return OsStatus::Ok;
+    Drain();
+    allocator_.Deallocate(cells_, sizeof(Cell) * (mask_ + 1), kStorageAlign);
+    cells_ = nullptr;
+    mask_  = 0;
+    return OsStatus::Ok;
+  }
+
+  OsStatus PutImpl(const T& msg, uint32_t timeout_ms) { return Push(timeout_ms, msg); }
+  OsStatus PutImpl(T&& msg, uint32_t timeout_ms) { return Push(timeout_ms, std::move(msg)); }
+  OsStatus PutImpl(const T& msg, const Deadline& deadline) { return Push(deadline, msg); }
+  OsStatus PutImpl(T&& msg, const Deadline& deadline) { return Push(deadline, std::move(msg)); }
+
+  template <typename... Args>
+  OsStatus EmplaceImpl(uint32_t timeout_ms, Args&&... args)
+  {
+    return Push(timeout_ms, std::forward<Args>(args)...);
+  }
+
+  OsStatus GetImpl(T& msg, uint32_t timeout_ms) { return Pop(msg, timeout_ms); }
+  OsStatus GetImpl(T& msg, const Deadline& deadline) { return Pop(msg, deadline); }
+
+  template <typename Timeout, typename... Args>
+  OsStatus Push(const Timeout& timeout, Args&&... args)
+  {
+    if (!cells_) return OsStatus::Error;
+    // The arguments are only consumed once a cell has been claimed
+    if (!not_full_.Wait([&] { return TryEmplace(std::forward<Args>(args)...); }, timeout))
+      return OsStatus::Timeout;
+    not_empty_.NotifyOne();
+    return OsStatus::Ok;
+  }
+
+  template <typename Timeout>
+  OsStatus Pop(T& msg, const Timeout& timeout)
+  {
+    if (!cells_) return OsStatus::Error;
+    if (!not_empty_.Wait([&] { return TryPop(msg); }, timeout))
+      return OsStatus::Timeout;
+    not_full_.NotifyOne();
+    return OsStatus::Ok;
+  }
+
+  uint32_t GetCountImpl() const
+  {
+    uint32_t deq = dequeue_pos_.load(std::memory_order_acquire);
+    uint32_t enq = enqueue_pos_.load(std::memory_order_acquire);
+    int32_t  n   = static_cast<int32_t>(enq - deq);
+    if (n < 0) return 0;
+    return (static_cast<uint32_t>(n) > mask_ + 1) ? mask_ + 1 : static_cast<uint32_t>(n);
+  }
+
+  uint32_t GetCapacityImpl() const { return cells_ ? mask_ + 1 : 0; }
+
+  SpinStats GetSpinStatsImpl() const
+  {
+    SpinStats a = not_empty_.Stats();
+    SpinStats b = not_full_.Stats();
+    return { a.spin_hits + b.spin_hits, a.parks + b.parks };
+  }
+
+  OsStatus ResetImpl()
+  {
+    if (!cells_) return OsStatus::Error;
+    Drain();
+    not_full_.NotifyAll();
+    return OsStatus::Ok;
+  }
+
+  template <typename... Args>
+  bool TryEmplace(Args&&... args)
+  {
+    uint32_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      uint32_t seq  = cell->seq.load(std::memory_order_acquire);
+      int32_t  diff = static_cast<int32_t>(seq - pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        return false;  // full
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    new (cell->data) T(std::forward<Args>(args)...);
+    cell->seq.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool TryPop(T& msg)
+  {
+    uint32_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      uint32_t seq  = cell->seq.load(std::memory_order_acquire);
+      int32_t  diff = static_cast<int32_t>(seq - (pos + 1));
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        return false;  // empty
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+    T* item = std::launder(reinterpret_cast<T*>(cell->data));
+    msg = std::move(*item);
+    item->~T();
+    cell->seq.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+  void Drain()
+  {
+    uint32_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell* cell = &cells_[pos & mask_];
+      uint32_t seq  = cell->seq.load(std::memory_order_acquire);
+      int32_t  diff = static_cast<int32_t>(seq - (pos + 1));
+      if (diff < 0) return;
+      if (diff > 0) { pos = dequeue_pos_.load(std::memory_order_relaxed); continue; }
+      if (!dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        continue;
+      std::launder(reinterpret_cast<T*>(cell->data))->~T();
+      cell->seq.store(pos + mask_ + 1, std::memory_order_release);
+      ++pos;
+    }
+  }
+
+private:
+  alignas(CacheLineSize) std::atomic<uint32_t> enqueue_pos_ {0};
+  alignas(CacheLineSize) std::atomic<uint32_t> dequeue_pos_ {0};
+  alignas(CacheLineSize) Cell*                 cells_ = nullptr;
+  uint32_t                                     mask_  = 0;
+  Allocator                                    allocator_;
+
+  Lot not_empty_;
+  Lot not_full_;
+};
+
+} // namespace ifce::os
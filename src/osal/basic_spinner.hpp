@@ -0,0 +1,88 @@
+#pragma once
+
+#include "osal/types.hpp"
+#include <atomic>
+
+namespace ifce::os::detail {
+
+inline void CpuRelax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+  __asm__ __volatile__("yield");
+#else
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/// Pause between retries of a lock-free loop: relax the core at first,
+/// then yield so a preempted writer can finish on a loaded or single-core
+/// machine instead of being spun against for a whole time slice.
+template <void (*Yield)()>
+inline void BasicBackoff(uint32_t& attempt)
+{
+  constexpr uint32_t kRelaxes = 64;
+  if (attempt < kRelaxes) {
+    ++attempt;
+    CpuRelax();
+  } else {
+    Yield();
+  }
+}
+
+/// Spin phase of a blocking wait, plus counters for tuning the budget.
+///
+/// Shared by the posix and cppstd backends, which alias it as Spinner over
+/// their own way of giving up the CPU (`Yield`) and of telling whether the
+/// host has a single CPU (`Uniprocessor`). There the pause spins are
+/// skipped: nothing can make ready() true until the waiter gives up the core.
+template <void (*Yield)(), bool (*Uniprocessor)()>
+class BasicSpinner
+{
+public:
+  void Configure(const SpinPolicy& policy) { policy_ = policy; }
+
+  /// Called after the caller's first check failed. Returns true as soon as
+  /// ready() holds, or false once the budget is spent and the caller should
+  /// park (and then call Parked()).
+  template <typename Pred>
+  bool Spin(Pred&& ready)
+  {
+    uint32_t pauses = 1;
+    uint32_t spins  = Uniprocessor() ? 0 : policy_.spins;
+    for (uint32_t i = 0; i < spins; ++i) {
+      for (uint32_t k = 0; k < pauses; ++k)
+        CpuRelax();
+      if (ready()) return Hit();
+      if (pauses < kMaxPauses) pauses <<= 1;
+    }
+    for (uint32_t i = 0; i < policy_.yields; ++i) {
+      Yield();
+      if (ready()) return Hit();
+    }
+    return false;
+  }
+
+  void Parked() { parks_.fetch_add(1, std::memory_order_relaxed); }
+
+  SpinStats Stats() const
+  {
+    return { hits_.load(std::memory_order_relaxed), parks_.load(std::memory_order_relaxed) };
+  }
+
+private:
+  static constexpr uint32_t kMaxPauses = 64;
+
+  bool Hit()
+  {
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  SpinPolicy            policy_;
+  std::atomic<uint32_t> hits_  {0};
+  std::atomic<uint32_t> parks_ {0};
+};
+
+} // namespace ifce::os::detail
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "osal/ability/message_queue.hpp"
+#include <atomic>
+#include <new>
+#include <utility>
+
+namespace ifce::os {
+
+/// Bounded single-producer / single-consumer queue.
+///
+/// Backed by a preallocated power-of-two ring. Head and tail live on
+/// separate cache lines and each side keeps a cached copy of the other's
+/// index, so the steady state touches no shared line except on wrap.
+/// Threads only park when the ring is actually empty or full.
+///
+/// Exactly one thread may call Put and exactly one thread may call Get.
+///
+/// Shared by the hosted backends, which alias it as SpscMessageQueue<T>
+/// over their own detail::ParkingLot (`Lot`).
+template <typename T, typename Lot>
+class BasicSpscMessageQueue : public MessageQueueAbility<BasicSpscMessageQueue<T, Lot>, T>
+{
+  friend class MessageQueueAbility<BasicSpscMessageQueue<T, Lot>, T>;
+  friend class ifce::DispatchBase<BasicSpscMessageQueue<T, Lot>>;
+
+public:
+  BasicSpscMessageQueue()  = default;
+  ~BasicSpscMessageQueue() { DeleteImpl(); }
+
+private:
+  struct Slot { alignas(T) unsigned char data[sizeof(T)]; };
+
+  static constexpr size_t kStorageAlign =
+    alignof(Slot) > CacheLineSize ? alignof(Slot) : CacheLineSize;
+
+  OsStatus CreateImpl(uint32_t capacity) { return CreateImpl(capacity, Allocator{}, SpinPolicy{}); }
+
+  OsStatus CreateImpl(uint32_t capacity, const Allocator& allocator, const SpinPolicy& spin)
+  {
+    if (slots_) return OsStatus::Busy;
+    if (capacity == 0) return OsStatus::Error;
+
+    uint32_t size = NextPowerOfTwo(capacity);
+    void* mem = allocator.Allocate(sizeof(Slot) * size, kStorageAlign);
+    if (!mem) return OsStatus::NoMemory;
+    slots_ = static_cast<Slot*>(mem);
+
+    not_empty_.Configure(spin);
+    not_full_.Configure(spin);
+    allocator_ = allocator;
+    mask_      = size - 1;
+    capacity_  = capacity;
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+    cached_head_ = 0;
+    cached_tail_ = 0;
+    return OsStatus::Ok;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    if (!slots_) return OsStatus::Ok;
+    Drain();
+    allocator_.Deallocate(slots_, sizeof(Slot) * (mask_ + 1), kStorageAlign);
+    slots_    = nullptr;
+    capacity_ = 0;
+    return OsStatus::Ok;
+  }
+
+  OsStatus PutImpl(const T& msg, uint32_t timeout_ms) { return Push(timeout_ms, msg); }
+  OsStatus PutImpl(T&& msg, uint32_t timeout_ms) { return Push(timeout_ms, std::move(msg)); }
+  OsStatus PutImpl(const T& msg, const Deadline& deadline) { return Push(deadline, msg); }
+  OsStatus PutImpl(T&& msg, const Deadline& deadline) { return Push(deadline, std::move(msg)); }
+
+  template <typename... Args>
+  OsStatus EmplaceImpl(uint32_t timeout_ms, Args&&... args)
+  {
+    return Push(timeout_ms, std::forward<Args>(args)...);
+  }
+
+  OsStatus GetImpl(T& msg, uint32_t timeout_ms) { return Pop(msg, timeout_ms); }
+  OsStatus GetImpl(T& msg, const Deadline& deadline) { return Pop(msg, deadline); }
+
+  template <typename Timeout, typename... Args>
+  OsStatus Push(const Timeout& timeout, Args&&... args)
+  {
+    if (!slots_) return OsStatus::Error;
+    if (!not_full_.Wait([this] { return HasSpace(); }, timeout))
+      return OsStatus::Timeout;
+
+    uint32_t tail = tail_.load(std::memory_order_relaxed);
+    new (SlotAt(tail)) T(std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    not_empty_.NotifyOne();
+    return OsStatus::Ok;
+  }
+
+  template <typename Timeout>
+  OsStatus Pop(T& msg, const Timeout& timeout)
+  {
+    if (!slots_) return OsStatus::Error;
+    if (!not_empty_.Wait([this] { return HasData(); }, timeout))
+      return OsStatus::Timeout;
+
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    T* item = SlotAt(head);
+    msg = std::move(*item);
+    item->~T();
+    head_.store(head + 1, std::memory_order_release);
+    not_full_.NotifyOne();
+    return OsStatus::Ok;
+  }
+
+  uint32_t GetCountImpl() const
+  {
+    uint32_t tail = tail_.load(std::memory_order_acquire);
+    uint32_t head = head_.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  uint32_t GetCapacityImpl() const { return capacity_; }
+
+  SpinStats GetSpinStatsImpl() const
+  {
+    SpinStats a = not_empty_.Stats();
+    SpinStats b = not_full_.Stats();
+    return { a.spin_hits + b.spin_hits, a.parks + b.parks };
+  }
+
+  /// Consumer side only: discards everything currently queued.
+  OsStatus ResetImpl()
+  {
+    if (!slots_) return OsStatus::Error;
+    Drain();
+    not_full_.NotifyAll();
+    return OsStatus::Ok;
+  }
+
+  // Producer side: refresh the cached head only when the ring looks full
+  bool HasSpace()
+  {
+    uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cached_head_ < capacity_) return true;
+    cached_head_ = head_.load(std::memory_order_acquire);
+    return tail - cached_head_ < capacity_;
+  }
+
+  // Consumer side: refresh the cached tail only when the ring looks empty
+  bool HasData()
+  {
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    if (head != cached_tail_) return true;
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    return head != cached_tail_;
+  }
+
+  void Drain()
+  {
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    uint32_t tail = tail_.load(std::memory_order_acquire);
+    for (; head != tail; ++head)
+      SlotAt(head)->~T();
+    head_.store(head, std::memory_order_release);
+  }
+
+  T* SlotAt(uint32_t index)
+  {
+    return std::launder(reinterpret_cast<T*>(slots_[index & mask_].data));
+  }
+
+private:
+  // Consumer-owned line
+  alignas(CacheLineSize) std::atomic<uint32_t> head_ {0};
+  uint32_t                                     cached_tail_ = 0;
+
+  // Producer-owned line
+  alignas(CacheLineSize) std::atomic<uint32_t> tail_ {0};
+  uint32_t                                     cached_head_ = 0;
+
+  // Read-mostly configuration
+  alignas(CacheLineSize) Slot* slots_    = nullptr;
+  uint32_t                     mask_     = 0;
+  uint32_t                     capacity_ = 0;
+  Allocator                    allocator_;
+
+  Lot not_empty_;
+  Lot not_full_;
+};
+
+} // namespace ifce::os
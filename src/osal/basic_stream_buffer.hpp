@@ -0,0 +1,239 @@
+#pragma once
+
+#include "osal/ability/stream_buffer.hpp"
+#include <atomic>
+#include <new>
+
+namespace ifce::os {
+
+/// Lock-free single-writer / single-reader byte ring.
+///
+/// The ring is a power-of-two byte array addressed by free-running head and
+/// tail counters on separate cache lines; each side caches the other's
+/// counter like SpscMessageQueue does. A wrapped region is exactly two
+/// spans, so Send/Receive are at most two memcpy calls and Reserve/Acquire
+/// hand the same spans out directly.
+///
+/// Exactly one thread may write (Send, Reserve, Commit) and exactly one
+/// thread may read (Receive, Acquire, Release, Reset).
+///
+/// Shared by the posix, cppstd and CMSIS-RTOS2 backends, which alias it as
+/// StreamBuffer over their own detail::ParkingLot (`Lot`). The lot's kernel
+/// objects, if any, live from Create to Delete (Lot::Open/Close).
+template <typename Lot>
+class BasicStreamBuffer : public StreamBufferAbility<BasicStreamBuffer<Lot>>
+{
+  friend class StreamBufferAbility<BasicStreamBuffer<Lot>>;
+  friend class ifce::DispatchBase<BasicStreamBuffer<Lot>>;
+
+public:
+  BasicStreamBuffer()  = default;
+  ~BasicStreamBuffer() { DeleteImpl(); }
+
+private:
+  static constexpr size_t kMaxCapacity = size_t(1) << 31;
+
+  OsStatus CreateImpl(size_t capacity, size_t trigger_level)
+  {
+    if (ring_) return OsStatus::Busy;
+    if (capacity == 0 || capacity > kMaxCapacity) return OsStatus::Error;
+
+    uint32_t size = NextPowerOfTwo(static_cast<uint32_t>(capacity));
+    ring_ = new (std::nothrow) uint8_t[size];
+    if (!ring_ || !not_empty_.Open() || !not_full_.Open()) {
+      DeleteImpl();
+      return OsStatus::NoMemory;
+    }
+
+    mask_     = size - 1;
+    capacity_ = static_cast<uint32_t>(capacity);
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+    cached_head_ = 0;
+    cached_tail_ = 0;
+    SetTriggerLevelImpl(trigger_level);
+    return OsStatus::Ok;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    not_empty_.Close();
+    not_full_.Close();
+    delete[] ring_;
+    ring_     = nullptr;
+    capacity_ = 0;
+    return OsStatus::Ok;
+  }
+
+  size_t SendImpl(const void* data, size_t len, uint32_t timeout_ms) { return Write(data, len, timeout_ms); }
+  size_t SendImpl(const void* data, size_t len, const Deadline& deadline) { return Write(data, len, deadline); }
+
+  size_t ReceiveImpl(void* data, size_t max, uint32_t timeout_ms) { return Read(data, max, timeout_ms); }
+  size_t ReceiveImpl(void* data, size_t max, const Deadline& deadline) { return Read(data, max, deadline); }
+
+  template <typename Timeout>
+  size_t Write(const void* data, size_t len, const Timeout& timeout)
+  {
+    if (!ring_ || len == 0) return 0;
+    size_t want = len < capacity_ ? len : capacity_;
+    not_full_.Wait([&] { return HasSpace(want); }, timeout);
+
+    size_t n = Space();
+    if (n > len) n = len;
+    if (n == 0) return 0;
+    Spans(tail_.load(std::memory_order_relaxed), n).CopyIn(0, data, n);
+    Produce(n);
+    return n;
+  }
+
+  template <typename Timeout>
+  size_t Read(void* data, size_t max, const Timeout& timeout)
+  {
+    if (!ring_ || max == 0) return 0;
+    not_empty_.Wait([&] { return HasData(Wanted(max)); }, timeout);
+
+    size_t n = Buffered();
+    if (n > max) n = max;
+    if (n == 0) return 0;
+    Spans(head_.load(std::memory_order_relaxed), n).CopyOut(0, data, n);
+    Consume(n);
+    return n;
+  }
+
+  SpanPair ReserveImpl(size_t min_bytes, uint32_t timeout_ms)
+  {
+    if (!ring_ || min_bytes > capacity_) return {};
+    if (!not_full_.Wait([&] { return HasSpace(min_bytes ? min_bytes : 1); }, timeout_ms))
+      return {};
+    return Spans(tail_.load(std::memory_order_relaxed), Space());
+  }
+
+  OsStatus CommitImpl(size_t bytes)
+  {
+    if (!ring_ || bytes > Space()) return OsStatus::Error;
+    if (bytes) Produce(bytes);
+    return OsStatus::Ok;
+  }
+
+  SpanPair AcquireImpl(uint32_t timeout_ms)
+  {
+    if (!ring_) return {};
+    not_empty_.Wait([&] { return HasData(Wanted(capacity_)); }, timeout_ms);
+    return Spans(head_.load(std::memory_order_relaxed), Buffered());
+  }
+
+  OsStatus ReleaseImpl(size_t bytes)
+  {
+    if (!ring_ || bytes > Buffered()) return OsStatus::Error;
+    if (bytes) Consume(bytes);
+    return OsStatus::Ok;
+  }
+
+  OsStatus SetTriggerLevelImpl(size_t trigger_level)
+  {
+    if (trigger_level == 0)        trigger_level = 1;
+    if (trigger_level > capacity_) trigger_level = capacity_;
+    trigger_.store(static_cast<uint32_t>(trigger_level), std::memory_order_relaxed);
+    not_empty_.NotifyAll();
+    return OsStatus::Ok;
+  }
+
+  size_t GetAvailableImpl() const
+  {
+    uint32_t tail = tail_.load(std::memory_order_acquire);
+    uint32_t head = head_.load(std::memory_order_acquire);
+    return tail - head;
+  }
+
+  size_t GetSpaceImpl() const { return capacity_ - GetAvailableImpl(); }
+
+  /// Reader side only: discards everything currently buffered.
+  OsStatus ResetImpl()
+  {
+    if (!ring_) return OsStatus::Error;
+    head_.store(tail_.load(std::memory_order_acquire), std::memory_order_release);
+    not_full_.NotifyAll();
+    return OsStatus::Ok;
+  }
+
+  size_t Wanted(size_t max) const
+  {
+    size_t trigger = trigger_.load(std::memory_order_relaxed);
+    return trigger < max ? trigger : max;
+  }
+
+  // Writer side: refresh the cached head only when space looks short
+  bool HasSpace(size_t n)
+  {
+    uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (capacity_ - (tail - cached_head_) >= n) return true;
+    cached_head_ = head_.load(std::memory_order_acquire);
+    return capacity_ - (tail - cached_head_) >= n;
+  }
+
+  size_t Space()
+  {
+    cached_head_ = head_.load(std::memory_order_acquire);
+    return capacity_ - (tail_.load(std::memory_order_relaxed) - cached_head_);
+  }
+
+  // Reader side: refresh the cached tail only when data looks short
+  bool HasData(size_t n)
+  {
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    if (cached_tail_ - head >= n) return true;
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    return cached_tail_ - head >= n;
+  }
+
+  size_t Buffered()
+  {
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    return cached_tail_ - head_.load(std::memory_order_relaxed);
+  }
+
+  void Produce(size_t n)
+  {
+    tail_.store(tail_.load(std::memory_order_relaxed) + static_cast<uint32_t>(n),
+                std::memory_order_release);
+    not_empty_.NotifyOne();
+  }
+
+  void Consume(size_t n)
+  {
+    head_.store(head_.load(std::memory_order_relaxed) + static_cast<uint32_t>(n),
+                std::memory_order_release);
+    not_full_.NotifyOne();
+  }
+
+  SpanPair Spans(uint32_t start, size_t len) const
+  {
+    uint32_t offset = start & mask_;
+    size_t   first  = mask_ + 1 - offset;
+    if (first > len) first = len;
+    SpanPair s;
+    s.first = { ring_ + offset, first };
+    if (len > first) s.second = { ring_, len - first };
+    return s;
+  }
+
+private:
+  // Reader-owned line
+  alignas(CacheLineSize) std::atomic<uint32_t> head_ {0};
+  uint32_t                                     cached_tail_ = 0;
+
+  // Writer-owned line
+  alignas(CacheLineSize) std::atomic<uint32_t> tail_ {0};
+  uint32_t                                     cached_head_ = 0;
+
+  // Read-mostly configuration
+  alignas(CacheLineSize) uint8_t* ring_     = nullptr;
+  uint32_t                        mask_     = 0;
+  uint32_t                        capacity_ = 0;
+  std::atomic<uint32_t>           trigger_  {1};
+
+  Lot not_empty_;
+  Lot not_full_;
+};
+
+} // namespace ifce::os
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "osal/ability/mailbox.hpp"
+#include "cmsis_os2.h"
+#include <type_traits>
+
+namespace ifce::os {
+
+/// Length-1 message queue. CMSIS-RTOS2 has neither overwrite nor peek:
+/// Overwrite evicts the stored value until its put fits, and Peek takes the
+/// value and puts it back unless a newer one arrived in the meantime.
+template <typename T>
+class Mailbox : public MailboxAbility<Mailbox<T>, T>
+{
+  static_assert(std::is_trivially_copyable_v<T>,
+    "RTOS queues copy messages bytewise; T must be trivially copyable");
+
+  friend class MailboxAbility<Mailbox<T>, T>;
+  friend class ifce::DispatchBase<Mailbox<T>>;
+
+public:
+  Mailbox()  = default;
+  ~Mailbox() { DeleteImpl(); }
+
+private:
+  OsStatus CreateImpl()
+  {
+    if (id_) return OsStatus::Busy;
+    id_ = osMessageQueueNew(1, sizeof(T), nullptr);
+    return id_ ? OsStatus::Ok : OsStatus::NoMemory;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    if (!id_) return OsStatus::Ok;
+    osStatus_t rc = osMessageQueueDelete(id_);
+    id_ = nullptr;
+    return (rc == osOK) ? OsStatus::Ok : OsStatus::Error;
+  }
+
+  OsStatus OverwriteImpl(const T& msg)
+  {
+    if (!id_) return OsStatus::Error;
+    while (osMessageQueuePut(id_, &msg, 0, 0) != osOK) {
+      T stale;
+      osMessageQueueGet(id_, &stale, nullptr, 0);
+    }
+    return OsStatus::Ok;
+  }
+
+  OsStatus PeekImpl(T& msg, uint32_t timeout_ms)
+  {
+    OsStatus rc = TakeImpl(msg, timeout_ms);
+    if (rc == OsStatus::Ok)
+      osMessageQueuePut(id_, &msg, 0, 0);
+    return rc;
+  }
+
+  OsStatus TakeImpl(T& msg, uint32_t timeout_ms)
+  {
+    if (!id_) return OsStatus::Error;
+    uint32_t ticks = (timeout_ms == WaitForever) ? osWaitForever : timeout_ms;
+    osStatus_t rc = osMessageQueueGet(id_, &msg, nullptr, ticks);
+    if (rc == osOK)           return OsStatus::Ok;
+    if (rc == osErrorTimeout) return OsStatus::Timeout;
+    return OsStatus::Error;
+  }
+
+  bool IsEmptyImpl() const
+  {
+    return !id_ || osMessageQueueGetCount(id_) == 0;
+  }
+
+public:
+  osMessageQueueId_t GetHandle() const { return id_; }
+
+private:
+  osMessageQueueId_t id_ = nullptr;
+};
+
+} // namespace ifce::os
@@ -1,44 +1,115 @@
 #pragma once
 
 #include "osal/ability/message_queue.hpp"
+#include "osal/derived/cmsis-rtos2/queue_set.hpp"
+#include "osal/queue_stats.hpp"
 #include "cmsis_os2.h"
+#include <atomic>
 #include <cstring>
+#include <type_traits>
 
 namespace ifce::os {
 
 template <typename T>
 class MessageQueue : public MessageQueueAbility<MessageQueue<T>, T>
 {
+  static_assert(std::is_trivially_copyable_v<T>,
+    "RTOS queues copy messages bytewise; T must be trivially copyable");
+
   friend class MessageQueueAbility<MessageQueue<T>, T>;
   friend class ifce::DispatchBase<MessageQueue<T>>;
+  friend class QueueSet;
+  template <typename, uint32_t> friend class StaticMessageQueue;
 
 public:
   MessageQueue()  = default;
   ~MessageQueue() { DeleteImpl(); }
 
 private:
+  struct TickMicros
+  {
+    static int64_t Now() { return int64_t(osKernelGetTickCount()) * 1000000 / osKernelGetTickFreq(); }
+  };
+
+  /// The kernel owns the slots, so there is nowhere to stamp messages and
+  /// the Put-to-Get latency histogram stays empty on this backend.
+  using Stats = detail::QueueStatsRecorder<TickMicros>;
+
   OsStatus CreateImpl(uint32_t capacity)
   {
     if (id_) return OsStatus::Busy;
     capacity_ = capacity;
+    policy_   = OverflowPolicy::Block;
+    rejected_.store(0, std::memory_order_relaxed);
+    evicted_.store(0, std::memory_order_relaxed);
     id_ = osMessageQueueNew(capacity, sizeof(T), nullptr);
     return id_ ? OsStatus::Ok : OsStatus::NoMemory;
   }
 
+  OsStatus CreateImpl(uint32_t capacity, OverflowPolicy policy)
+  {
+    OsStatus rc = CreateImpl(capacity);
+    if (rc == OsStatus::Ok) policy_ = policy;
+    return rc;
+  }
+
+  OsStatus CreateStaticImpl(uint32_t capacity, const osMessageQueueAttr_t& attr)
+  {
+    if (id_) return OsStatus::Busy;
+    capacity_ = capacity;
+    policy_   = OverflowPolicy::Block;
+    rejected_.store(0, std::memory_order_relaxed);
+    evicted_.store(0, std::memory_order_relaxed);
+    id_ = osMessageQueueNew(capacity, sizeof(T), &attr);
+    return id_ ? OsStatus::Ok : OsStatus::Error;
+  }
+
   OsStatus DeleteImpl()
   {
     if (!id_) return OsStatus::Ok;
+    if (queue_set_) queue_set_->Detach(*this);
     osStatus_t rc = osMessageQueueDelete(id_);
     id_ = nullptr;
     return (rc == osOK) ? OsStatus::Ok : OsStatus::Error;
   }
 
-  OsStatus PutImpl(const T& msg, uint32_t timeout_ms)
+  OsStatus PutImpl(const T& msg, uint32_t timeout_ms) { return PutImpl(msg, 0, timeout_ms); }
+
+  /// Lossy policies never block the producer. DropOldest discards the
+  /// message Get would return next until the new one fits; the kernel
+  /// queue exposes no arrival order, so with mixed priorities that is the
+  /// highest-priority head rather than the earliest-queued message. It
+  /// cannot reach the lowest-priority message either, so EvictLowest
+  /// rejects like DropNewest.
+  OsStatus PutImpl(const T& msg, uint8_t priority, uint32_t timeout_ms)
   {
     if (!id_) return OsStatus::Error;
-    uint32_t ticks = (timeout_ms == WaitForever) ? osWaitForever : timeout_ms;
-    osStatus_t rc = osMessageQueuePut(id_, &msg, 0, ticks);
-    if (rc == osOK)           return OsStatus::Ok;
+    bool     lossy = policy_ != OverflowPolicy::Block;
+    uint32_t ticks = lossy ? 0 : (timeout_ms == WaitForever) ? osWaitForever : timeout_ms;
+    int64_t since = stats_.Now();
+    osStatus_t rc = osMessageQueuePut(id_, &msg, priority, ticks);
+    bool replaced = false;
+    while (rc == osErrorResource && policy_ == OverflowPolicy::DropOldest) {
+      alignas(T) unsigned char victim[sizeof(T)];
+      if (osMessageQueueGet(id_, victim, nullptr, 0) == osOK) {
+        evicted_.fetch_add(1, std::memory_order_relaxed);
+        replaced = true;
+      }
+      rc = osMessageQueuePut(id_, &msg, priority, 0);
+    }
+    stats_.Blocked(true, stats_.Now() - since);
+    if (rc == osOK) {
+      stats_.Put(Stats::kEnabled ? GetCountImpl() : 0);
+      // An evicted message's set event is still pending; it now stands
+      // for this one
+      if (queue_set_ && !replaced) queue_set_->Post(this);
+      return OsStatus::Ok;
+    }
+    if (rc == osErrorTimeout || rc == osErrorResource) stats_.PutTimeout();
+    if (lossy && rc == osErrorResource) {
+      rejected_.fetch_add(1, std::memory_order_relaxed);
+      return OsStatus::Timeout;
+    }
     if (rc == osErrorTimeout) return OsStatus::Timeout;
     return OsStatus::Error;
   }
@@ -47,8 +118,14 @@ private:
   {
     if (!id_) return OsStatus::Error;
     uint32_t ticks = (timeout_ms == WaitForever) ? osWaitForever : timeout_ms;
+    int64_t since = stats_.Now();
     osStatus_t rc = osMessageQueueGet(id_, &msg, nullptr, ticks);
-    if (rc == osOK)           return OsStatus::Ok;
+    stats_.Blocked(false, stats_.Now() - since);
+    if (rc == osOK) {
+      stats_.Get();
+      return OsStatus::Ok;
+    }
+    if (rc == osErrorTimeout || rc == osErrorResource) stats_.GetTimeout();
     if (rc == osErrorTimeout) return OsStatus::Timeout;
     return OsStatus::Error;
   }
@@ -65,18 +142,33 @@ private:
     return osMessageQueueGetCapacity(id_);
   }
 
+  QueueStats GetStatsImpl() const { return stats_.Snapshot(); }
+
+  DropStats GetDropStatsImpl() const
+  {
+    return { rejected_.load(std::memory_order_relaxed), evicted_.load(std::memory_order_relaxed) };
+  }
+
   OsStatus ResetImpl()
   {
     if (!id_) return OsStatus::Error;
     return (osMessageQueueReset(id_) == osOK) ? OsStatus::Ok : OsStatus::Error;
   }
 
+  void BindQueueSet(QueueSet* set) { queue_set_ = set; }
+
 public:
   osMessageQueueId_t GetHandle() const { return id_; }
 
 private:
-  osMessageQueueId_t id_       = nullptr;
-  uint32_t           capacity_ = 0;
+  osMessageQueueId_t    id_        = nullptr;
+  QueueSet*             queue_set_ = nullptr;
+  detail::QueueSetHook  set_hook_;
+  uint32_t              capacity_  = 0;
+  OverflowPolicy        policy_    = OverflowPolicy::Block;
+  std::atomic<uint32_t> rejected_  {0};
+  std::atomic<uint32_t> evicted_   {0};
+  Stats                 stats_;
 };
 
 } // namespace ifce::os
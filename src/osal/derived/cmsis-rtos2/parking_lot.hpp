@@ -0,0 +1,75 @@
+#pragma once
+
+#include "osal/types.hpp"
+#include "cmsis_os2.h"
+
+namespace ifce::os::detail {
+
+/// Blocking for the lock-free single-waiter primitives: one binary
+/// semaphore per direction. A stale token only causes a spurious wake-up;
+/// waiters always re-check their condition.
+///
+/// The semaphore is made by Open() rather than the constructor, so static
+/// objects can be built before the kernel starts.
+class ParkingLot
+{
+public:
+  ParkingLot()  = default;
+  ~ParkingLot() { Close(); }
+
+  ParkingLot(const ParkingLot&)            = delete;
+  ParkingLot& operator=(const ParkingLot&) = delete;
+
+  bool Open()
+  {
+    if (!signal_) signal_ = osSemaphoreNew(1, 0, nullptr);
+    return signal_ != nullptr;
+  }
+
+  void Close()
+  {
+    if (signal_) osSemaphoreDelete(signal_);
+    signal_ = nullptr;
+  }
+
+  /// Block until ready() returns true or the timeout expires.
+  /// Returns the final value of ready().
+  template <typename Pred>
+  bool Wait(Pred&& ready, uint32_t timeout_ms)
+  {
+    uint32_t start = osKernelGetTickCount();
+    while (!ready()) {
+      uint32_t ticks = osWaitForever;
+      if (timeout_ms != WaitForever) {
+        uint32_t elapsed = osKernelGetTickCount() - start;
+        if (elapsed >= timeout_ms) return false;
+        ticks = timeout_ms - elapsed;
+      }
+      if (osSemaphoreAcquire(signal_, ticks) != osOK)
+        return ready();
+    }
+    return true;
+  }
+
+  template <typename Pred>
+  bool Wait(Pred&& ready, const Deadline& deadline)
+  {
+    while (!ready()) {
+      uint32_t ticks = deadline.IsNever() ? osWaitForever : deadline.RemainingMs();
+      if (ticks == 0) return false;
+      if (osSemaphoreAcquire(signal_, ticks) != osOK)
+        return ready();
+    }
+    return true;
+  }
+
+  void NotifyOne() { if (signal_) osSemaphoreRelease(signal_); }
+
+  /// Each lot has at most one waiter (the single reader or writer).
+  void NotifyAll() { NotifyOne(); }
+
+private:
+  osSemaphoreId_t signal_ = nullptr;
+};
+
+} // namespace ifce::os::detail
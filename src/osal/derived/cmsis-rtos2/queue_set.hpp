@@ -0,0 +1,118 @@
+#pragma once
+
+#include "osal/ability/queue_set.hpp"
+#include "cmsis_os2.h"
+
+namespace ifce::os {
+
+template <typename T> class MessageQueue;
+class Semaphore;
+
+/// CMSIS-RTOS2 has no queue sets: members post their own address into an
+/// osMessageQueue of pending events each time they publish an item, and
+/// Select() is a single osMessageQueueGet on it.
+class QueueSet : public QueueSetAbility<QueueSet>
+{
+  friend class QueueSetAbility<QueueSet>;
+  friend class ifce::DispatchBase<QueueSet>;
+  template <typename> friend class MessageQueue;
+  friend class Semaphore;
+
+public:
+  QueueSet()  = default;
+  ~QueueSet() { DeleteImpl(); }
+
+private:
+  OsStatus CreateImpl(uint32_t max_events)
+  {
+    if (id_) return OsStatus::Busy;
+    id_ = osMessageQueueNew(max_events, sizeof(const void*), nullptr);
+    return id_ ? OsStatus::Ok : OsStatus::NoMemory;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    if (!id_) return OsStatus::Ok;
+    UnbindAll();
+    osStatus_t rc = osMessageQueueDelete(id_);
+    id_ = nullptr;
+    return (rc == osOK) ? OsStatus::Ok : OsStatus::Error;
+  }
+
+  template <typename Member>
+  OsStatus AddImpl(Member& member)
+  {
+    if (!id_) return OsStatus::Error;
+    if (member.queue_set_ || member.GetCount() != 0) return OsStatus::Busy;
+    member.set_hook_ = detail::QueueSetHook{
+      members_, &member, [](void* m) { static_cast<Member*>(m)->BindQueueSet(nullptr); }};
+    members_ = &member.set_hook_;
+    member.BindQueueSet(this);
+    return OsStatus::Ok;
+  }
+
+  template <typename Member>
+  OsStatus RemoveImpl(Member& member)
+  {
+    if (!id_ || member.queue_set_ != this) return OsStatus::Error;
+    if (member.GetCount() != 0) return OsStatus::Busy;
+    Detach(member);
+    return OsStatus::Ok;
+  }
+
+  /// Unbinds `member` and drops its pending events. Also called by a member
+  /// being deleted, whatever it still holds.
+  template <typename Member>
+  void Detach(Member& member)
+  {
+    member.BindQueueSet(nullptr);
+    for (detail::QueueSetHook** link = &members_; *link; link = &(*link)->next) {
+      if (*link == &member.set_hook_) {
+        *link = member.set_hook_.next;
+        break;
+      }
+    }
+
+    // Drop events left behind by items that were read without a Select
+    uint32_t pending = osMessageQueueGetCount(id_);
+    for (uint32_t i = 0; i < pending; ++i) {
+      const void* ev = nullptr;
+      if (osMessageQueueGet(id_, &ev, nullptr, 0) != osOK) break;
+      if (ev != &member) osMessageQueuePut(id_, &ev, 0, 0);
+    }
+  }
+
+  /// Members left attached would otherwise post to a deleted queue id.
+  void UnbindAll()
+  {
+    while (members_) {
+      detail::QueueSetHook* hook = members_;
+      members_ = hook->next;
+      hook->unbind(hook->member);
+    }
+  }
+
+  const void* SelectImpl(uint32_t timeout_ms)
+  {
+    if (!id_) return nullptr;
+    uint32_t ticks = (timeout_ms == WaitForever) ? osWaitForever : timeout_ms;
+    const void* member = nullptr;
+    return (osMessageQueueGet(id_, &member, nullptr, ticks) == osOK) ? member : nullptr;
+  }
+
+  /// Called by a member after it published one item. Never blocks, so it
+  /// is safe from ISRs.
+  void Post(const void* member)
+  {
+    osMessageQueuePut(id_, &member, 0, 0);
+  }
+
+public:
+  osMessageQueueId_t GetHandle() const { return id_; }
+
+private:
+  osMessageQueueId_t    id_      = nullptr;
+  detail::QueueSetHook* members_ = nullptr;
+};
+
+} // namespace ifce::os
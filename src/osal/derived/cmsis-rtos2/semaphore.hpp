@@ -1,6 +1,7 @@
 #pragma once
 
 #include "osal/ability/semaphore.hpp"
+#include "osal/derived/cmsis-rtos2/queue_set.hpp"
 #include "cmsis_os2.h"
 
 namespace ifce::os {
@@ -9,6 +10,7 @@ class Semaphore : public SemaphoreAbility<Semaphore>
 {
   friend class SemaphoreAbility<Semaphore>;
   friend class ifce::DispatchBase<Semaphore>;
+  friend class QueueSet;
 
 public:
   Semaphore()  = default;
@@ -25,6 +27,7 @@ private:
   OsStatus DeleteImpl()
   {
     if (!id_) return OsStatus::Ok;
+    if (queue_set_) queue_set_->Detach(*this);
     osStatus_t rc = osSemaphoreDelete(id_);
     id_ = nullptr;
     return (rc == osOK) ? OsStatus::Ok : OsStatus::Error;
@@ -43,7 +46,9 @@ private:
   OsStatus ReleaseImpl()
   {
     if (!id_) return OsStatus::Error;
-    return (osSemaphoreRelease(id_) == osOK) ? OsStatus::Ok : OsStatus::Error;
+    if (osSemaphoreRelease(id_) != osOK) return OsStatus::Error;
+    if (queue_set_) queue_set_->Post(this);
+    return OsStatus::Ok;
   }
 
   uint32_t GetCountImpl() const
@@ -52,11 +57,15 @@ private:
     return osSemaphoreGetCount(id_);
   }
 
+  void BindQueueSet(QueueSet* set) { queue_set_ = set; }
+
 public:
   osSemaphoreId_t GetHandle() const { return id_; }
 
 private:
-  osSemaphoreId_t id_ = nullptr;
+  osSemaphoreId_t      id_        = nullptr;
+  QueueSet*            queue_set_ = nullptr;
+  detail::QueueSetHook set_hook_;
 };
 
 } // namespace ifce::os
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "osal/derived/cmsis-rtos2/message_queue.hpp"
+
+namespace ifce::os {
+
+/// The native RTOS queue is already a fixed ring with copy-in/copy-out
+/// semantics and no lock handoff beyond the kernel critical section, so the
+/// SPSC variant simply maps onto it.
+template <typename T>
+using SpscMessageQueue = MessageQueue<T>;
+
+} // namespace ifce::os
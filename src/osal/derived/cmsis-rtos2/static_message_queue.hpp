@@ -0,0 +1,77 @@
+#pragma once
+
+#include "osal/derived/cmsis-rtos2/message_queue.hpp"
+#if __has_include("rtx_os.h")
+  #include "rtx_os.h"
+#endif
+
+/// Message-storage bytes for `count` messages of `size` bytes. RTX5 keeps a
+/// per-message header in mq_mem, so a plain count * size is too small
+/// there; rtx_os.h supplies the real formula. Other kernels must say how
+/// much they need, e.g. ((count) * (size)) for the FreeRTOS wrapper.
+#ifndef OSAL_CMSIS_MQ_MEM_SIZE
+  #if defined(osRtxMessageQueueMemSize)
+    #define OSAL_CMSIS_MQ_MEM_SIZE(count, size) osRtxMessageQueueMemSize(count, size)
+  #endif
+#endif
+
+/// Control-block bytes handed to osMessageQueueNew. RTX5 sizes are used
+/// when rtx_os.h is visible; other kernels may define this (e.g. to
+/// sizeof(StaticQueue_t) for the FreeRTOS wrapper). 0 leaves the control
+/// block to the kernel.
+#ifndef OSAL_CMSIS_MQ_CB_SIZE
+  #if defined(osRtxMessageQueueCbSize)
+    #define OSAL_CMSIS_MQ_CB_SIZE osRtxMessageQueueCbSize
+  #else
+    #define OSAL_CMSIS_MQ_CB_SIZE 0
+  #endif
+#endif
+
+namespace ifce::os {
+
+/// MessageQueue whose message storage (mq_mem) lives inside the object.
+/// Create() takes no capacity; the heap overload of MessageQueue::Create
+/// is hidden.
+template <typename T, uint32_t N>
+class StaticMessageQueue : public MessageQueue<T>
+{
+  static_assert(N > 0, "StaticMessageQueue needs at least one slot");
+
+  using Queue = MessageQueue<T>;
+
+#if defined(OSAL_CMSIS_MQ_MEM_SIZE)
+  static constexpr uint32_t kMemSize = OSAL_CMSIS_MQ_MEM_SIZE(N, sizeof(T));
+#else
+  // Guessing would under-size mq_mem on kernels with per-message overhead
+  static_assert(sizeof(T) == 0,
+                "StaticMessageQueue: rtx_os.h not found; define OSAL_CMSIS_MQ_MEM_SIZE(count, size)");
+  static constexpr uint32_t kMemSize = 1;
+#endif
+  static constexpr uint32_t kCbSize  = OSAL_CMSIS_MQ_CB_SIZE;
+
+public:
+  static constexpr uint32_t kCapacity = N;
+
+  StaticMessageQueue()  = default;
+  ~StaticMessageQueue() { Queue::Delete(); }
+
+  OsStatus Create(OverflowPolicy policy = OverflowPolicy::Block)
+  {
+    osMessageQueueAttr_t attr = {};
+    attr.mq_mem  = mem_;
+    attr.mq_size = kMemSize;
+    if (kCbSize) {
+      attr.cb_mem  = cb_;
+      attr.cb_size = kCbSize;
+    }
+    OsStatus rc = Queue::CreateStaticImpl(N, attr);
+    if (rc == OsStatus::Ok) Queue::policy_ = policy;
+    return rc;
+  }
+
+private:
+  alignas(8) uint8_t mem_[kMemSize];
+  alignas(8) uint8_t cb_[kCbSize ? kCbSize : 1];
+};
+
+} // namespace ifce::os
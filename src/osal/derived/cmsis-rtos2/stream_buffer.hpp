@@ -0,0 +1,13 @@
+#pragma once
+
+#include "osal/basic_stream_buffer.hpp"
+#include "osal/derived/cmsis-rtos2/parking_lot.hpp"
+
+namespace ifce::os {
+
+/// CMSIS-RTOS2 has no stream buffer, so this is the same lock-free byte
+/// ring as the hosted backends, blocking on a binary semaphore per
+/// direction.
+using StreamBuffer = BasicStreamBuffer<detail::ParkingLot>;
+
+} // namespace ifce::os
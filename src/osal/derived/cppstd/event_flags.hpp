@@ -52,6 +52,11 @@ private:
   }
 
   uint32_t WaitImpl(uint32_t flags, bool wait_all, bool auto_clear, uint32_t timeout_ms)
+  {
+    return WaitImpl(flags, wait_all, auto_clear, Deadline::FromTimeout(timeout_ms));
+  }
+
+  uint32_t WaitImpl(uint32_t flags, bool wait_all, bool auto_clear, const Deadline& deadline)
   {
     if (!initialized_) return 0;
     std::unique_lock<std::mutex> lock(mutex_);
@@ -62,13 +67,11 @@ private:
                       : ((current & flags) != 0);
     };
 
-    if (timeout_ms == WaitForever) {
+    if (deadline.IsNever()) {
       cv_.wait(lock, condition);
-    } else if (timeout_ms > 0) {
-      if (!cv_.wait_for(lock, std::chrono::milliseconds(timeout_ms), condition))
-        return 0;
     } else {
-      if (!condition()) return 0;
+      if (!cv_.wait_until(lock, deadline.ToTimePoint(), condition))
+        return 0;
     }
 
     uint32_t result = flags_.load() & flags;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "osal/ability/mutex.hpp"
+#include "osal/derived/cppstd/spin.hpp"
 #include <mutex>
 #include <chrono>
 
@@ -16,9 +17,12 @@ public:
   ~Mutex() { DeleteImpl(); }
 
 private:
-  OsStatus CreateImpl(bool recursive)
+  OsStatus CreateImpl(bool recursive) { return CreateImpl(recursive, SpinPolicy{}); }
+
+  OsStatus CreateImpl(bool recursive, const SpinPolicy& spin)
   {
     if (initialized_) return OsStatus::Busy;
+    spinner_.Configure(spin);
     recursive_   = recursive;
     initialized_ = true;
     return OsStatus::Ok;
@@ -30,22 +34,32 @@ private:
     return OsStatus::Ok;
   }
 
-  OsStatus LockImpl(uint32_t timeout_ms)
+  OsStatus LockImpl(uint32_t timeout_ms) { return LockImpl(Deadline::FromTimeout(timeout_ms)); }
+
+  OsStatus LockImpl(const Deadline& deadline)
   {
     if (!initialized_) return OsStatus::Error;
-    if (timeout_ms == WaitForever) {
+    auto try_lock = [this] {
+      return recursive_ ? recursive_mutex_.try_lock() : timed_mutex_.try_lock();
+    };
+    if (try_lock()) return OsStatus::Ok;
+    if (deadline.Expired()) return OsStatus::Timeout;
+    if (spinner_.Spin(try_lock)) return OsStatus::Ok;
+    spinner_.Parked();
+
+    if (deadline.IsNever()) {
       if (recursive_)
         recursive_mutex_.lock();
       else
-        mutex_.lock();
+        timed_mutex_.lock();
       return OsStatus::Ok;
     }
-    auto duration = std::chrono::milliseconds(timeout_ms);
+    auto until = deadline.ToTimePoint();
     bool ok;
     if (recursive_)
-      ok = recursive_mutex_.try_lock_for(duration);
+      ok = recursive_mutex_.try_lock_until(until);
     else
-      ok = timed_mutex_.try_lock_for(duration);
+      ok = timed_mutex_.try_lock_until(until);
     return ok ? OsStatus::Ok : OsStatus::Timeout;
   }
 
@@ -54,10 +68,8 @@ private:
     if (!initialized_) return OsStatus::Error;
     if (recursive_)
       recursive_mutex_.unlock();
-    else {
-      // Unlock whichever was locked
-      mutex_.unlock();
-    }
+    else
+      timed_mutex_.unlock();
     return OsStatus::Ok;
   }
 
@@ -68,14 +80,16 @@ private:
     if (recursive_)
       ok = recursive_mutex_.try_lock();
     else
-      ok = mutex_.try_lock();
+      ok = timed_mutex_.try_lock();
     return ok ? OsStatus::Ok : OsStatus::Busy;
   }
 
+  SpinStats GetSpinStatsImpl() const { return spinner_.Stats(); }
+
 private:
-  std::mutex                     mutex_;
   std::recursive_timed_mutex     recursive_mutex_;
   std::timed_mutex               timed_mutex_;
+  detail::Spinner                spinner_;
   bool                           recursive_   = false;
   bool                           initialized_ = false;
 };
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "osal/basic_message_queue.hpp"
+#include "osal/derived/cppstd/queue_set.hpp"
+#include "osal/derived/cppstd/spin.hpp"
+#include <mutex>
+#include <condition_variable>
+
+namespace ifce::os::detail {
+
+/// std::mutex with Lock/Unlock, for StdCondition.
+class StdMutex
+{
+public:
+  /// Nothing to create; Open/Close only satisfy BasicMemoryPool.
+  bool Open()  { return true; }
+  void Close() {}
+
+  void Lock()   { mutex_.lock(); }
+  void Unlock() { mutex_.unlock(); }
+
+private:
+  friend class StdCondition;
+  std::mutex mutex_;
+};
+
+/// std::condition_variable waited on with a StdMutex already held.
+class StdCondition
+{
+public:
+  /// Returns false on timeout. The mutex is held again on return.
+  bool Wait(StdMutex& mutex, const Deadline& deadline)
+  {
+    std::unique_lock<std::mutex> lock(mutex.mutex_, std::adopt_lock);
+    bool ok = true;
+    if (deadline.IsNever())
+      cv_.wait(lock);
+    else
+      ok = cv_.wait_until(lock, deadline.ToTimePoint()) == std::cv_status::no_timeout;
+    lock.release();
+    return ok;
+  }
+
+  void Signal()    { cv_.notify_one(); }
+  void Broadcast() { cv_.notify_all(); }
+
+private:
+  std::condition_variable cv_;
+};
+
+/// BasicMessageQueue's lock and wait primitives.
+struct QueueSync
+{
+  using Mutex    = StdMutex;
+  using Cond     = StdCondition;
+  using Spinner  = detail::Spinner;
+  using ReadyFd  = NoReadyFd;
+  using QueueSet = os::QueueSet;
+};
+
+} // namespace ifce::os::detail
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "osal/ability/semaphore.hpp"
+#include "osal/derived/cppstd/queue_set.hpp"
+#include "osal/derived/cppstd/spin.hpp"
 #include <mutex>
 #include <condition_variable>
 #include <chrono>
@@ -12,6 +14,7 @@ class Semaphore : public SemaphoreAbility<Semaphore>
 {
   friend class SemaphoreAbility<Semaphore>;
   friend class ifce::DispatchBase<Semaphore>;
+  friend class QueueSet;
 
 public:
   Semaphore()  = default;
@@ -19,8 +22,14 @@ public:
 
 private:
   OsStatus CreateImpl(uint32_t max_count, uint32_t initial_count)
+  {
+    return CreateImpl(max_count, initial_count, SpinPolicy{});
+  }
+
+  OsStatus CreateImpl(uint32_t max_count, uint32_t initial_count, const SpinPolicy& spin)
   {
     if (initialized_) return OsStatus::Busy;
+    spinner_.Configure(spin);
     max_count_   = max_count;
     count_       = initial_count;
     initialized_ = true;
@@ -29,20 +38,37 @@ private:
 
   OsStatus DeleteImpl()
   {
+    if (queue_set_) queue_set_->Detach(*this);
     initialized_ = false;
     return OsStatus::Ok;
   }
 
-  OsStatus AcquireImpl(uint32_t timeout_ms)
+  OsStatus AcquireImpl(uint32_t timeout_ms) { return AcquireImpl(Deadline::FromTimeout(timeout_ms)); }
+
+  OsStatus AcquireImpl(const Deadline& deadline)
   {
     if (!initialized_) return OsStatus::Error;
     std::unique_lock<std::mutex> lock(mutex_);
 
-    if (timeout_ms == WaitForever) {
+    if (count_ == 0 && !deadline.Expired()) {
+      // Spin with the lock dropped, re-taking it only to check the count
+      lock.unlock();
+      bool hit = spinner_.Spin([&] {
+        lock.lock();
+        if (count_ > 0) return true;
+        lock.unlock();
+        return false;
+      });
+      if (!hit) {
+        lock.lock();
+        spinner_.Parked();
+      }
+    }
+
+    if (deadline.IsNever()) {
       cv_.wait(lock, [this] { return count_ > 0; });
     } else {
-      if (!cv_.wait_for(lock, std::chrono::milliseconds(timeout_ms),
-                        [this] { return count_ > 0; }))
+      if (!cv_.wait_until(lock, deadline.ToTimePoint(), [this] { return count_ > 0; }))
         return OsStatus::Timeout;
     }
     --count_;
@@ -58,14 +84,23 @@ private:
       ++count_;
     }
     cv_.notify_one();
+    if (queue_set_) queue_set_->Post(this);
     return OsStatus::Ok;
   }
 
   uint32_t GetCountImpl() const { return count_; }
 
+  /// Release posts outside mutex_, so attach before the semaphore is shared.
+  void BindQueueSet(QueueSet* set) { queue_set_ = set; }
+
+  SpinStats GetSpinStatsImpl() const { return spinner_.Stats(); }
+
 private:
   std::mutex              mutex_;
   std::condition_variable cv_;
+  detail::Spinner         spinner_;
+  QueueSet*               queue_set_   = nullptr;
+  detail::QueueSetHook    set_hook_;
   uint32_t                max_count_   = 0;
   uint32_t                count_       = 0;
   bool                    initialized_ = false;
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "osal/basic_spinner.hpp"
+#include <thread>
+
+namespace ifce::os::detail {
+
+inline void YieldThread() { std::this_thread::yield(); }
+
+inline bool Uniprocessor()
+{
+  static const bool one = std::thread::hardware_concurrency() == 1;
+  return one;
+}
+
+inline void Backoff(uint32_t& attempt) { BasicBackoff<YieldThread>(attempt); }
+
+using Spinner = BasicSpinner<YieldThread, Uniprocessor>;
+
+} // namespace ifce::os::detail
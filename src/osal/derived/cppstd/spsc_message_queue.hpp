@@ -0,0 +1,11 @@
+#pragma once
+
+#include "osal/basic_spsc_message_queue.hpp"
+#include "osal/derived/cppstd/parking_lot.hpp"
+
+namespace ifce::os {
+
+template <typename T>
+using SpscMessageQueue = BasicSpscMessageQueue<T, detail::ParkingLot>;
+
+} // namespace ifce::os
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "osal/basic_stream_buffer.hpp"
+#include "osal/derived/cppstd/parking_lot.hpp"
+
+namespace ifce::os {
+
+using StreamBuffer = BasicStreamBuffer<detail::ParkingLot>;
+
+} // namespace ifce::os
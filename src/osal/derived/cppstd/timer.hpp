@@ -9,6 +9,7 @@
 
 namespace ifce::os {
 
+/// Software timer on a std::thread, with the posix Timer's schedule.
 class Timer : public TimerAbility<Timer>
 {
   friend class TimerAbility<Timer>;
@@ -71,16 +72,18 @@ private:
 
   void TimerLoop()
   {
+    // Fire on a fixed monotonic schedule so callback time does not drift it
+    Deadline next = Deadline::In(Duration::Millis(period_ms_));
     do {
       std::unique_lock<std::mutex> lock(mutex_);
-      cv_.wait_for(lock, std::chrono::milliseconds(period_ms_),
-                   [this] { return !running_.load(); });
+      cv_.wait_until(lock, next.ToTimePoint(), [this] { return !running_.load(); });
 
       if (!running_.load()) break;
 
       if (callback_)
         callback_(user_arg_);
 
+      next = next.NextSlot(Duration::Millis(period_ms_));
     } while (auto_reload_ && running_.load());
 
     running_.store(false);
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "osal/ability/mailbox.hpp"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include <type_traits>
+
+namespace ifce::os {
+
+/// Length-1 queue written with xQueueOverwrite, the FreeRTOS mailbox idiom.
+template <typename T>
+class Mailbox : public MailboxAbility<Mailbox<T>, T>
+{
+  static_assert(std::is_trivially_copyable_v<T>,
+    "RTOS queues copy messages bytewise; T must be trivially copyable");
+
+  friend class MailboxAbility<Mailbox<T>, T>;
+  friend class ifce::DispatchBase<Mailbox<T>>;
+
+public:
+  Mailbox()  = default;
+  ~Mailbox() { DeleteImpl(); }
+
+private:
+  OsStatus CreateImpl()
+  {
+    if (handle_) return OsStatus::Busy;
+    handle_ = xQueueCreate(1, sizeof(T));
+    return handle_ ? OsStatus::Ok : OsStatus::NoMemory;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    if (!handle_) return OsStatus::Ok;
+    vQueueDelete(handle_);
+    handle_ = nullptr;
+    return OsStatus::Ok;
+  }
+
+  OsStatus OverwriteImpl(const T& msg)
+  {
+    if (!handle_) return OsStatus::Error;
+    xQueueOverwrite(handle_, &msg);
+    return OsStatus::Ok;
+  }
+
+  OsStatus PeekImpl(T& msg, uint32_t timeout_ms)
+  {
+    if (!handle_) return OsStatus::Error;
+    TickType_t ticks = (timeout_ms == WaitForever) ? portMAX_DELAY
+                       : pdMS_TO_TICKS(timeout_ms);
+    return (xQueuePeek(handle_, &msg, ticks) == pdTRUE) ? OsStatus::Ok : OsStatus::Timeout;
+  }
+
+  OsStatus TakeImpl(T& msg, uint32_t timeout_ms)
+  {
+    if (!handle_) return OsStatus::Error;
+    TickType_t ticks = (timeout_ms == WaitForever) ? portMAX_DELAY
+                       : pdMS_TO_TICKS(timeout_ms);
+    return (xQueueReceive(handle_, &msg, ticks) == pdTRUE) ? OsStatus::Ok : OsStatus::Timeout;
+  }
+
+  bool IsEmptyImpl() const
+  {
+    return !handle_ || uxQueueMessagesWaiting(handle_) == 0;
+  }
+
+public:
+  // FreeRTOS-specific ISR helpers
+  OsStatus OverwriteFromISR(const T& msg, BaseType_t* pxHigherPriorityTaskWoken = nullptr)
+  {
+    if (!handle_) return OsStatus::Error;
+    BaseType_t dummy = pdFALSE;
+    BaseType_t* p = pxHigherPriorityTaskWoken ? pxHigherPriorityTaskWoken : &dummy;
+    xQueueOverwriteFromISR(handle_, &msg, p);
+    return OsStatus::Ok;
+  }
+
+  QueueHandle_t GetHandle() const { return handle_; }
+
+private:
+  QueueHandle_t handle_ = nullptr;
+};
+
+} // namespace ifce::os
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "osal/ability/message_buffer.hpp"
+#include "freertos/FreeRTOS.h"
+#include "freertos/message_buffer.h"
+
+namespace ifce::os {
+
+/// Native FreeRTOS message buffer; each message carries a size_t length
+/// prefix. Span access is not available (the kernel ring is private).
+class MessageBuffer : public MessageBufferAbility<MessageBuffer>
+{
+  friend class MessageBufferAbility<MessageBuffer>;
+  friend class ifce::DispatchBase<MessageBuffer>;
+
+public:
+  MessageBuffer()  = default;
+  ~MessageBuffer() { DeleteImpl(); }
+
+private:
+  OsStatus CreateImpl(size_t capacity)
+  {
+    if (handle_) return OsStatus::Busy;
+    if (capacity <= sizeof(size_t)) return OsStatus::Error;
+    handle_ = xMessageBufferCreate(capacity);
+    return handle_ ? OsStatus::Ok : OsStatus::NoMemory;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    if (!handle_) return OsStatus::Ok;
+    vMessageBufferDelete(handle_);
+    handle_ = nullptr;
+    return OsStatus::Ok;
+  }
+
+  size_t SendImpl(const void* data, size_t len, uint32_t timeout_ms)
+  {
+    if (!handle_ || len == 0) return 0;
+    TickType_t ticks = (timeout_ms == WaitForever) ? portMAX_DELAY
+                       : pdMS_TO_TICKS(timeout_ms);
+    return xMessageBufferSend(handle_, data, len, ticks);
+  }
+
+  size_t ReceiveImpl(void* data, size_t max, uint32_t timeout_ms)
+  {
+    if (!handle_) return 0;
+    TickType_t ticks = (timeout_ms == WaitForever) ? portMAX_DELAY
+                       : pdMS_TO_TICKS(timeout_ms);
+    return xMessageBufferReceive(handle_, data, max, ticks);
+  }
+
+  size_t GetNextLengthImpl() const { return handle_ ? xMessageBufferNextLengthBytes(handle_) : 0; }
+  size_t GetSpaceImpl()      const { return handle_ ? xMessageBufferSpacesAvailable(handle_) : 0; }
+  bool   IsEmptyImpl()       const { return !handle_ || xMessageBufferIsEmpty(handle_) == pdTRUE; }
+
+  /// Fails with Busy while a task is blocked on the buffer.
+  OsStatus ResetImpl()
+  {
+    if (!handle_) return OsStatus::Error;
+    return (xMessageBufferReset(handle_) == pdPASS) ? OsStatus::Ok : OsStatus::Busy;
+  }
+
+public:
+  // FreeRTOS-specific ISR helpers
+  size_t SendFromISR(const void* data, size_t len, BaseType_t* pxHigherPriorityTaskWoken = nullptr)
+  {
+    if (!handle_ || len == 0) return 0;
+    BaseType_t dummy = pdFALSE;
+    BaseType_t* p = pxHigherPriorityTaskWoken ? pxHigherPriorityTaskWoken : &dummy;
+    return xMessageBufferSendFromISR(handle_, data, len, p);
+  }
+
+  size_t ReceiveFromISR(void* data, size_t max, BaseType_t* pxHigherPriorityTaskWoken = nullptr)
+  {
+    if (!handle_) return 0;
+    BaseType_t dummy = pdFALSE;
+    BaseType_t* p = pxHigherPriorityTaskWoken ? pxHigherPriorityTaskWoken : &dummy;
+    return xMessageBufferReceiveFromISR(handle_, data, max, p);
+  }
+
+  MessageBufferHandle_t GetHandle() const { return handle_; }
+
+private:
+  MessageBufferHandle_t handle_ = nullptr;
+};
+
+} // namespace ifce::os
@@ -1,30 +1,73 @@
 #pragma once
 
 #include "osal/ability/message_queue.hpp"
+#include "osal/queue_stats.hpp"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
+#include "freertos/task.h"
+#include <atomic>
+#include <type_traits>
 
 namespace ifce::os {
 
+/// A DropOldest queue cannot join a QueueSet: the kernel leaves the
+/// evicted message's set event pending and posts another for its
+/// replacement, so the set would hold two events for one message.
 template <typename T>
 class MessageQueue : public MessageQueueAbility<MessageQueue<T>, T>
 {
+  static_assert(std::is_trivially_copyable_v<T>,
+    "RTOS queues copy messages bytewise; T must be trivially copyable");
+
   friend class MessageQueueAbility<MessageQueue<T>, T>;
   friend class ifce::DispatchBase<MessageQueue<T>>;
+  friend class QueueSet;
+  template <typename, uint32_t> friend class StaticMessageQueue;
 
 public:
   MessageQueue()  = default;
   ~MessageQueue() { DeleteImpl(); }
 
 private:
+  struct TickMicros
+  {
+    static int64_t Now() { return int64_t(xTaskGetTickCount()) * 1000000 / configTICK_RATE_HZ; }
+  };
+
+  /// The kernel owns the slots, so there is nowhere to stamp messages and
+  /// the Put-to-Get latency histogram stays empty on this backend.
+  using Stats = detail::QueueStatsRecorder<TickMicros>;
+
   OsStatus CreateImpl(uint32_t capacity)
   {
     if (handle_) return OsStatus::Busy;
     capacity_ = capacity;
+    policy_   = OverflowPolicy::Block;
+    rejected_.store(0, std::memory_order_relaxed);
+    evicted_.store(0, std::memory_order_relaxed);
     handle_ = xQueueCreate(capacity, sizeof(T));
     return handle_ ? OsStatus::Ok : OsStatus::NoMemory;
   }
 
+  OsStatus CreateImpl(uint32_t capacity, OverflowPolicy policy)
+  {
+    OsStatus rc = CreateImpl(capacity);
+    if (rc == OsStatus::Ok) policy_ = policy;
+    return rc;
+  }
+
+  /// Requires configSUPPORT_STATIC_ALLOCATION.
+  OsStatus CreateStaticImpl(uint32_t capacity, uint8_t* storage, StaticQueue_t* buffer)
+  {
+    if (handle_) return OsStatus::Busy;
+    capacity_ = capacity;
+    policy_   = OverflowPolicy::Block;
+    rejected_.store(0, std::memory_order_relaxed);
+    evicted_.store(0, std::memory_order_relaxed);
+    handle_ = xQueueCreateStatic(capacity, sizeof(T), storage, buffer);
+    return handle_ ? OsStatus::Ok : OsStatus::Error;
+  }
+
   OsStatus DeleteImpl()
   {
     if (!handle_) return OsStatus::Ok;
@@ -36,25 +79,26 @@ private:
   OsStatus PutImpl(const T& msg, uint32_t timeout_ms)
   {
     if (!handle_) return OsStatus::Error;
-    TickType_t ticks = (timeout_ms == WaitForever) ? portMAX_DELAY
-                       : pdMS_TO_TICKS(timeout_ms);
-    return (xQueueSend(handle_, &msg, ticks) == pdTRUE) ? OsStatus::Ok : OsStatus::Timeout;
+    return Transfer(true, timeout_ms, [&](TickType_t t) { return xQueueSend(handle_, &msg, t); });
   }
 
   OsStatus GetImpl(T& msg, uint32_t timeout_ms)
   {
     if (!handle_) return OsStatus::Error;
-    TickType_t ticks = (timeout_ms == WaitForever) ? portMAX_DELAY
-                       : pdMS_TO_TICKS(timeout_ms);
-    return (xQueueReceive(handle_, &msg, ticks) == pdTRUE) ? OsStatus::Ok : OsStatus::Timeout;
+    return Transfer(false, timeout_ms, [&](TickType_t t) { return xQueueReceive(handle_, &msg, t); });
   }
 
   OsStatus PutToFrontImpl(const T& msg, uint32_t timeout_ms)
   {
     if (!handle_) return OsStatus::Error;
-    TickType_t ticks = (timeout_ms == WaitForever) ? portMAX_DELAY
-                       : pdMS_TO_TICKS(timeout_ms);
-    return (xQueueSendToFront(handle_, &msg, ticks) == pdTRUE) ? OsStatus::Ok : OsStatus::Timeout;
+    return Transfer(true, timeout_ms, [&](TickType_t t) { return xQueueSendToFront(handle_, &msg, t); });
+  }
+
+  /// FreeRTOS queues have no priorities: any non-zero priority jumps to the
+  /// front, so urgent messages overtake normal ones (LIFO among themselves).
+  OsStatus PutImpl(const T& msg, uint8_t priority, uint32_t timeout_ms)
+  {
+    return priority ? PutToFrontImpl(msg, timeout_ms) : PutImpl(msg, timeout_ms);
   }
 
   uint32_t GetCountImpl() const
@@ -65,6 +109,13 @@ private:
 
   uint32_t GetCapacityImpl() const { return capacity_; }
 
+  QueueStats GetStatsImpl() const { return stats_.Snapshot(); }
+
+  DropStats GetDropStatsImpl() const
+  {
+    return { rejected_.load(std::memory_order_relaxed), evicted_.load(std::memory_order_relaxed) };
+  }
+
   OsStatus ResetImpl()
   {
     if (!handle_) return OsStatus::Error;
@@ -72,6 +123,52 @@ private:
     return OsStatus::Ok;
   }
 
+  /// Checked by QueueSet::Add.
+  bool EvictsOnPut() const { return policy_ == OverflowPolicy::DropOldest; }
+
+  /// One blocking kernel send/receive. The kernel does not report whether
+  /// the call blocked, so its whole duration counts as wait time.
+  template <typename Op>
+  OsStatus Transfer(bool put, uint32_t timeout_ms, Op&& op)
+  {
+    if (put && policy_ != OverflowPolicy::Block) return PutLossy(op);
+
+    TickType_t ticks = (timeout_ms == WaitForever) ? portMAX_DELAY
+                       : pdMS_TO_TICKS(timeout_ms);
+    int64_t since = stats_.Now();
+    bool ok = op(ticks) == pdTRUE;
+    stats_.Blocked(put, stats_.Now() - since);
+
+    if (!ok) {
+      if (put) stats_.PutTimeout();
+      else     stats_.GetTimeout();
+      return OsStatus::Timeout;
+    }
+    if (put) stats_.Put(Stats::kEnabled ? GetCountImpl() : 0);
+    else     stats_.Get();
+    return OsStatus::Ok;
+  }
+
+  /// Lossy policies never block the producer. DropOldest discards the head
+  /// until the message fits. The kernel queue cannot reach a lower-priority
+  /// message, so EvictLowest rejects like DropNewest.
+  template <typename Op>
+  OsStatus PutLossy(Op& send)
+  {
+    while (send(0) != pdTRUE) {
+      if (policy_ != OverflowPolicy::DropOldest) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        stats_.PutTimeout();
+        return OsStatus::Timeout;
+      }
+      alignas(T) unsigned char victim[sizeof(T)];
+      if (xQueueReceive(handle_, victim, 0) == pdTRUE)
+        evicted_.fetch_add(1, std::memory_order_relaxed);
+    }
+    stats_.Put(Stats::kEnabled ? GetCountImpl() : 0);
+    return OsStatus::Ok;
+  }
+
 public:
   // FreeRTOS-specific ISR helpers
   OsStatus PutFromISR(const T& msg, BaseType_t* pxHigherPriorityTaskWoken = nullptr)
@@ -79,7 +176,18 @@ public:
     if (!handle_) return OsStatus::Error;
     BaseType_t dummy = pdFALSE;
     BaseType_t* p = pxHigherPriorityTaskWoken ? pxHigherPriorityTaskWoken : &dummy;
-    return (xQueueSendFromISR(handle_, &msg, p) == pdTRUE) ? OsStatus::Ok : OsStatus::Error;
+    while (xQueueSendFromISR(handle_, &msg, p) != pdTRUE) {
+      if (policy_ == OverflowPolicy::Block) return OsStatus::Error;
+      if (policy_ != OverflowPolicy::DropOldest) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return OsStatus::Error;
+      }
+      alignas(T) unsigned char victim[sizeof(T)];
+      if (xQueueReceiveFromISR(handle_, victim, p) == pdTRUE)
+        evicted_.fetch_add(1, std::memory_order_relaxed);
+    }
+    stats_.Put(Stats::kEnabled ? uxQueueMessagesWaitingFromISR(handle_) : 0);
+    return OsStatus::Ok;
   }
 
   OsStatus GetFromISR(T& msg, BaseType_t* pxHigherPriorityTaskWoken = nullptr)
@@ -87,14 +195,20 @@ public:
     if (!handle_) return OsStatus::Error;
     BaseType_t dummy = pdFALSE;
     BaseType_t* p = pxHigherPriorityTaskWoken ? pxHigherPriorityTaskWoken : &dummy;
-    return (xQueueReceiveFromISR(handle_, &msg, p) == pdTRUE) ? OsStatus::Ok : OsStatus::Error;
+    if (xQueueReceiveFromISR(handle_, &msg, p) != pdTRUE) return OsStatus::Error;
+    stats_.Get();
+    return OsStatus::Ok;
   }
 
   QueueHandle_t GetHandle() const { return handle_; }
 
 private:
-  QueueHandle_t handle_   = nullptr;
-  uint32_t      capacity_ = 0;
+  QueueHandle_t         handle_   = nullptr;
+  uint32_t              capacity_ = 0;
+  OverflowPolicy        policy_   = OverflowPolicy::Block;
+  std::atomic<uint32_t> rejected_ {0};
+  std::atomic<uint32_t> evicted_  {0};
+  Stats                 stats_;
 };
 
 } // namespace ifce::os
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "osal/ability/queue_set.hpp"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+namespace ifce::os {
+
+/// Native FreeRTOS queue set (requires configUSE_QUEUE_SETS == 1).
+/// Members are any OSAL object whose GetHandle() is a queue or semaphore;
+/// the kernel keeps the membership, so Remove() a member before deleting it.
+/// Add() rejects a MessageQueue created with OverflowPolicy::DropOldest
+/// (Error), since its evictions would leave stale set events behind.
+class QueueSet : public QueueSetAbility<QueueSet>
+{
+  friend class QueueSetAbility<QueueSet>;
+  friend class ifce::DispatchBase<QueueSet>;
+
+public:
+  QueueSet()  = default;
+  ~QueueSet() { DeleteImpl(); }
+
+  /// Members tracked for mapping a ready handle back to its OSAL object.
+  static constexpr uint32_t kMaxMembers = 16;
+
+private:
+  struct Entry
+  {
+    QueueSetMemberHandle_t handle;
+    const void*            member;
+  };
+
+  OsStatus CreateImpl(uint32_t max_events)
+  {
+    if (handle_) return OsStatus::Busy;
+    handle_ = xQueueCreateSet(max_events);
+    return handle_ ? OsStatus::Ok : OsStatus::NoMemory;
+  }
+
+  /// Takes the remaining members out of the set first, so the kernel never
+  /// notifies a deleted set. FreeRTOS only releases empty members: Busy,
+  /// with the set kept, while any of them still holds items.
+  OsStatus DeleteImpl()
+  {
+    if (!handle_) return OsStatus::Ok;
+    for (; member_count_ > 0; --member_count_) {
+      if (xQueueRemoveFromSet(members_[member_count_ - 1].handle, handle_) != pdPASS)
+        return OsStatus::Busy;
+    }
+    vQueueDelete(handle_);
+    handle_       = nullptr;
+    member_count_ = 0;
+    return OsStatus::Ok;
+  }
+
+  template <typename Member>
+  OsStatus AddImpl(Member& member)
+  {
+    if (!handle_) return OsStatus::Error;
+    if (member_count_ == kMaxMembers) return OsStatus::NoMemory;
+    if (EvictsOnPut(member, 0)) return OsStatus::Error;
+    auto h = static_cast<QueueSetMemberHandle_t>(member.GetHandle());
+    if (xQueueAddToSet(h, handle_) != pdPASS) return OsStatus::Busy;
+    members_[member_count_++] = Entry{h, &member};
+    return OsStatus::Ok;
+  }
+
+  template <typename Member>
+  OsStatus RemoveImpl(Member& member)
+  {
+    if (!handle_) return OsStatus::Error;
+    auto h = static_cast<QueueSetMemberHandle_t>(member.GetHandle());
+    for (uint32_t i = 0; i < member_count_; ++i) {
+      if (members_[i].handle != h) continue;
+      if (xQueueRemoveFromSet(h, handle_) != pdPASS) return OsStatus::Busy;
+      members_[i] = members_[--member_count_];
+      return OsStatus::Ok;
+    }
+    return OsStatus::Error;
+  }
+
+  /// A member that evicts on Put (a DropOldest MessageQueue) would leave
+  /// the kernel one stale set event per eviction.
+  template <typename Member>
+  static auto EvictsOnPut(const Member& member, int) -> decltype(member.EvictsOnPut())
+  {
+    return member.EvictsOnPut();
+  }
+
+  template <typename Member>
+  static bool EvictsOnPut(const Member&, long) { return false; }
+
+  const void* SelectImpl(uint32_t timeout_ms)
+  {
+    if (!handle_) return nullptr;
+    TickType_t ticks = (timeout_ms == WaitForever) ? portMAX_DELAY
+                       : pdMS_TO_TICKS(timeout_ms);
+    QueueSetMemberHandle_t ready = xQueueSelectFromSet(handle_, ticks);
+    if (!ready) return nullptr;
+    for (uint32_t i = 0; i < member_count_; ++i)
+      if (members_[i].handle == ready) return members_[i].member;
+    return nullptr;
+  }
+
+public:
+  QueueSetHandle_t GetHandle() const { return handle_; }
+
+private:
+  QueueSetHandle_t handle_       = nullptr;
+  Entry            members_[kMaxMembers];
+  uint32_t         member_count_ = 0;
+};
+
+} // namespace ifce::os
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "osal/derived/freertos/message_queue.hpp"
+
+namespace ifce::os {
+
+/// MessageQueue whose ring and control block live inside the object
+/// (xQueueCreateStatic), so no heap is used. Create() takes no capacity;
+/// the heap overload of MessageQueue::Create is hidden.
+/// Requires configSUPPORT_STATIC_ALLOCATION.
+template <typename T, uint32_t N>
+class StaticMessageQueue : public MessageQueue<T>
+{
+  static_assert(N > 0, "StaticMessageQueue needs at least one slot");
+
+  using Queue = MessageQueue<T>;
+
+public:
+  static constexpr uint32_t kCapacity = N;
+
+  StaticMessageQueue()  = default;
+  ~StaticMessageQueue() { Queue::Delete(); }
+
+  OsStatus Create(OverflowPolicy policy = OverflowPolicy::Block)
+  {
+    OsStatus rc = Queue::CreateStaticImpl(N, storage_, &buffer_);
+    if (rc == OsStatus::Ok) Queue::policy_ = policy;
+    return rc;
+  }
+
+private:
+  uint8_t       storage_[N * sizeof(T)];
+  StaticQueue_t buffer_;
+};
+
+} // namespace ifce::os
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "osal/ability/stream_buffer.hpp"
+#include "freertos/FreeRTOS.h"
+#include "freertos/stream_buffer.h"
+
+namespace ifce::os {
+
+/// Native FreeRTOS stream buffer. The kernel keeps its ring private, so
+/// span access (Reserve/Commit/Acquire/Release) is not available here.
+class StreamBuffer : public StreamBufferAbility<StreamBuffer>
+{
+  friend class StreamBufferAbility<StreamBuffer>;
+  friend class ifce::DispatchBase<StreamBuffer>;
+
+public:
+  StreamBuffer()  = default;
+  ~StreamBuffer() { DeleteImpl(); }
+
+private:
+  OsStatus CreateImpl(size_t capacity, size_t trigger_level)
+  {
+    if (handle_) return OsStatus::Busy;
+    if (capacity == 0) return OsStatus::Error;
+    if (trigger_level == 0)       trigger_level = 1;
+    if (trigger_level > capacity) trigger_level = capacity;
+    handle_ = xStreamBufferCreate(capacity, trigger_level);
+    return handle_ ? OsStatus::Ok : OsStatus::NoMemory;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    if (!handle_) return OsStatus::Ok;
+    vStreamBufferDelete(handle_);
+    handle_ = nullptr;
+    return OsStatus::Ok;
+  }
+
+  size_t SendImpl(const void* data, size_t len, uint32_t timeout_ms)
+  {
+    if (!handle_) return 0;
+    TickType_t ticks = (timeout_ms == WaitForever) ? portMAX_DELAY
+                       : pdMS_TO_TICKS(timeout_ms);
+    return xStreamBufferSend(handle_, data, len, ticks);
+  }
+
+  size_t ReceiveImpl(void* data, size_t max, uint32_t timeout_ms)
+  {
+    if (!handle_) return 0;
+    TickType_t ticks = (timeout_ms == WaitForever) ? portMAX_DELAY
+                       : pdMS_TO_TICKS(timeout_ms);
+    return xStreamBufferReceive(handle_, data, max, ticks);
+  }
+
+  OsStatus SetTriggerLevelImpl(size_t trigger_level)
+  {
+    if (!handle_) return OsStatus::Error;
+    return (xStreamBufferSetTriggerLevel(handle_, trigger_level) == pdTRUE) ? OsStatus::Ok
+                                                                             : OsStatus::Error;
+  }
+
+  size_t GetAvailableImpl() const { return handle_ ? xStreamBufferBytesAvailable(handle_) : 0; }
+  size_t GetSpaceImpl()     const { return handle_ ? xStreamBufferSpacesAvailable(handle_) : 0; }
+
+  /// Fails with Busy while a task is blocked on the buffer.
+  OsStatus ResetImpl()
+  {
+    if (!handle_) return OsStatus::Error;
+    return (xStreamBufferReset(handle_) == pdPASS) ? OsStatus::Ok : OsStatus::Busy;
+  }
+
+public:
+  // FreeRTOS-specific ISR helpers
+  size_t SendFromISR(const void* data, size_t len, BaseType_t* pxHigherPriorityTaskWoken = nullptr)
+  {
+    if (!handle_) return 0;
+    BaseType_t dummy = pdFALSE;
+    BaseType_t* p = pxHigherPriorityTaskWoken ? pxHigherPriorityTaskWoken : &dummy;
+    return xStreamBufferSendFromISR(handle_, data, len, p);
+  }
+
+  size_t ReceiveFromISR(void* data, size_t max, BaseType_t* pxHigherPriorityTaskWoken = nullptr)
+  {
+    if (!handle_) return 0;
+    BaseType_t dummy = pdFALSE;
+    BaseType_t* p = pxHigherPriorityTaskWoken ? pxHigherPriorityTaskWoken : &dummy;
+    return xStreamBufferReceiveFromISR(handle_, data, max, p);
+  }
+
+  StreamBufferHandle_t GetHandle() const { return handle_; }
+
+private:
+  StreamBufferHandle_t handle_ = nullptr;
+};
+
+} // namespace ifce::os
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "osal/types.hpp"
+#include <pthread.h>
+#include <semaphore.h>
+#include <ctime>
+#include <cerrno>
+
+// pthread_mutex_clocklock / sem_clockwait arrived in glibc 2.30
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 30))
+  #define OSAL_POSIX_HAS_CLOCKWAIT 1
+#endif
+
+namespace ifce::os::detail {
+
+/// Condition variables time out against CLOCK_MONOTONIC, matching Deadline.
+inline void InitMonotonicCond(pthread_cond_t* cond)
+{
+  pthread_condattr_t attr;
+  pthread_condattr_init(&attr);
+  pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+  pthread_cond_init(cond, &attr);
+  pthread_condattr_destroy(&attr);
+}
+
+/// Returns false on timeout. `deadline` must not be Never.
+inline bool CondWaitUntil(pthread_cond_t* cond, pthread_mutex_t* mutex, const Deadline& deadline)
+{
+  struct timespec ts = deadline.ToTimespec();
+  return pthread_cond_timedwait(cond, mutex, &ts) != ETIMEDOUT;
+}
+
+#if !defined(OSAL_POSIX_HAS_CLOCKWAIT)
+/// CLOCK_REALTIME equivalent of a monotonic deadline, for APIs that have
+/// no clock parameter. Only used where the *_clock* variants are missing.
+inline struct timespec RealtimeFor(const Deadline& deadline)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_REALTIME, &ts);
+  int64_t left = deadline.Remaining().us;
+  ts.tv_sec  += static_cast<time_t>(left / 1000000);
+  ts.tv_nsec += static_cast<long>(left % 1000000) * 1000L;
+  if (ts.tv_nsec >= 1000000000L) { ts.tv_sec++; ts.tv_nsec -= 1000000000L; }
+  return ts;
+}
+#endif
+
+/// pthread_mutex_lock with a monotonic deadline; returns the pthread error.
+inline int MutexLockUntil(pthread_mutex_t* mutex, const Deadline& deadline)
+{
+#if defined(OSAL_POSIX_HAS_CLOCKWAIT)
+  struct timespec ts = deadline.ToTimespec();
+  return pthread_mutex_clocklock(mutex, CLOCK_MONOTONIC, &ts);
+#else
+  struct timespec ts = RealtimeFor(deadline);
+  return pthread_mutex_timedlock(mutex, &ts);
+#endif
+}
+
+/// sem_wait with a monotonic deadline; returns 0 or sets errno like sem_timedwait.
+inline int SemWaitUntil(sem_t* sem, const Deadline& deadline)
+{
+#if defined(OSAL_POSIX_HAS_CLOCKWAIT)
+  struct timespec ts = deadline.ToTimespec();
+  return sem_clockwait(sem, CLOCK_MONOTONIC, &ts);
+#else
+  struct timespec ts = RealtimeFor(deadline);
+  return sem_timedwait(sem, &ts);
+#endif
+}
+
+} // namespace ifce::os::detail
@@ -1,10 +1,15 @@
 #pragma once
 
 #include "osal/ability/event_flags.hpp"
+#include "osal/derived/posix/clock.hpp"
+#include "osal/derived/posix/ready_fd.hpp"
 #include <pthread.h>
 #include <ctime>
 #include <cerrno>
 #include <atomic>
+#if defined(OSAL_POSIX_FUTEX)
+  #include "osal/derived/posix/futex.hpp"
+#endif
 
 namespace ifce::os {
 
@@ -18,11 +23,110 @@ public:
   ~EventFlags() { DeleteImpl(); }
 
 private:
+#if defined(OSAL_POSIX_FUTEX)
+  // flags_ is the futex word: waiters sleep on the value they last saw.
+  // Only Set wakes them. A Clear that lands before a waiter parks makes
+  // its FUTEX_WAIT fail with EAGAIN and re-check; one that lands after
+  // wakes nobody, which is fine since removing flags never satisfies a
+  // wait.
+  OsStatus CreateImpl()
+  {
+    if (initialized_) return OsStatus::Busy;
+    flags_.store(0);
+    waiters_.store(0);
+    initialized_ = true;
+    return OsStatus::Ok;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    ready_fd_.Close();
+    initialized_ = false;
+    return OsStatus::Ok;
+  }
+
+  uint32_t SetImpl(uint32_t flags)
+  {
+    if (!initialized_) return 0;
+    uint32_t current = flags_.fetch_or(flags) | flags;
+    if (waiters_.load() != 0)
+      detail::FutexWake(&flags_, INT_MAX);
+    RefreshFd();
+    return current;
+  }
+
+  // No wake: clearing flags cannot satisfy any waiter
+  uint32_t ClearImpl(uint32_t flags)
+  {
+    if (!initialized_) return 0;
+    uint32_t prev = flags_.fetch_and(~flags);
+    RefreshFd();
+    return prev;
+  }
+
+  uint32_t WaitImpl(uint32_t flags, bool wait_all, bool auto_clear, uint32_t timeout_ms)
+  {
+    return WaitImpl(flags, wait_all, auto_clear, Deadline::FromTimeout(timeout_ms));
+  }
+
+  uint32_t WaitImpl(uint32_t flags, bool wait_all, bool auto_clear, const Deadline& deadline)
+  {
+    if (!initialized_) return 0;
+
+    // Every exit goes through the single waiters_ decrement below
+    bool     parked  = false;
+    bool     got     = false;
+    uint32_t current = flags_.load();
+    for (;;) {
+      bool met = wait_all ? (current & flags) == flags : (current & flags) != 0;
+      if (met) {
+        uint32_t next = auto_clear ? (current & ~flags) : current;
+        if (next == current || flags_.compare_exchange_weak(current, next)) {
+          got = true;
+          break;
+        }
+        continue;
+      }
+      if (deadline.Expired()) break;
+      if (!parked) {
+        waiters_.fetch_add(1);
+        parked = true;
+      }
+      // On timeout, loop once more so flags set at the last moment still count
+      detail::FutexWait(&flags_, current, deadline);
+      current = flags_.load();
+    }
+
+    if (parked) waiters_.fetch_sub(1);
+    if (!got) return 0;
+    if (auto_clear) RefreshFd();
+    return current & flags;
+  }
+
+  uint32_t GetImpl() const
+  {
+    return flags_.load();
+  }
+
+  int GetNativeFdImpl()
+  {
+    if (!initialized_) return -1;
+    return ready_fd_.Open([this] { return flags_.load() != 0; });
+  }
+
+  void RefreshFd() { ready_fd_.Refresh([this] { return flags_.load() != 0; }); }
+
+private:
+  std::atomic<uint32_t> flags_       {0};
+  std::atomic<uint32_t> waiters_     {0};
+  detail::ReadyFd       ready_fd_;
+  bool                  initialized_ = false;
+#else
   OsStatus CreateImpl()
   {
     if (initialized_) return OsStatus::Busy;
     pthread_mutex_init(&mutex_, nullptr);
-    pthread_cond_init(&cond_, nullptr);
+    detail::InitMonotonicCond(&cond_);
     flags_.store(0);
     initialized_ = true;
     return OsStatus::Ok;
@@ -31,6 +135,7 @@ private:
   OsStatus DeleteImpl()
   {
     if (!initialized_) return OsStatus::Ok;
+    ready_fd_.Close();
     pthread_cond_destroy(&cond_);
     pthread_mutex_destroy(&mutex_);
     initialized_ = false;
@@ -45,17 +150,25 @@ private:
     uint32_t current = flags_.load();
     pthread_cond_broadcast(&cond_);
     pthread_mutex_unlock(&mutex_);
+    RefreshFd();
     return current;
   }
 
+  // No wake: clearing flags cannot satisfy any waiter
   uint32_t ClearImpl(uint32_t flags)
   {
     if (!initialized_) return 0;
     uint32_t prev = flags_.fetch_and(~flags);
+    RefreshFd();
     return prev;
   }
 
   uint32_t WaitImpl(uint32_t flags, bool wait_all, bool auto_clear, uint32_t timeout_ms)
+  {
+    return WaitImpl(flags, wait_all, auto_clear, Deadline::FromTimeout(timeout_ms));
+  }
+
+  uint32_t WaitImpl(uint32_t flags, bool wait_all, bool auto_clear, const Deadline& deadline)
   {
     if (!initialized_) return 0;
     pthread_mutex_lock(&mutex_);
@@ -68,27 +181,17 @@ private:
         return (current & flags) != 0;
     };
 
-    if (timeout_ms == WaitForever) {
+    if (deadline.IsNever()) {
       while (!condition_met())
         pthread_cond_wait(&cond_, &mutex_);
-    } else if (timeout_ms > 0) {
-      struct timespec ts;
-      clock_gettime(CLOCK_REALTIME, &ts);
-      ts.tv_sec  += timeout_ms / 1000;
-      ts.tv_nsec += (timeout_ms % 1000) * 1000000L;
-      if (ts.tv_nsec >= 1000000000L) { ts.tv_sec++; ts.tv_nsec -= 1000000000L; }
-
+    } else {
       while (!condition_met()) {
-        if (pthread_cond_timedwait(&cond_, &mutex_, &ts) == ETIMEDOUT) {
+        if (deadline.Expired() || !detail::CondWaitUntil(&cond_, &mutex_, deadline)) {
+          if (condition_met()) break;
           pthread_mutex_unlock(&mutex_);
           return 0;
         }
       }
-    } else {
-      if (!condition_met()) {
-        pthread_mutex_unlock(&mutex_);
-        return 0;
-      }
     }
 
     uint32_t result = flags_.load() & flags;
@@ -96,6 +199,7 @@ private:
       flags_.fetch_and(~flags);
 
     pthread_mutex_unlock(&mutex_);
+    if (auto_clear) RefreshFd();
     return result;
   }
 
@@ -104,11 +208,21 @@ private:
     return flags_.load();
   }
 
+  int GetNativeFdImpl()
+  {
+    if (!initialized_) return -1;
+    return ready_fd_.Open([this] { return flags_.load() != 0; });
+  }
+
+  void RefreshFd() { ready_fd_.Refresh([this] { return flags_.load() != 0; }); }
+
 private:
   pthread_mutex_t       mutex_       = PTHREAD_MUTEX_INITIALIZER;
   pthread_cond_t        cond_        = PTHREAD_COND_INITIALIZER;
   std::atomic<uint32_t> flags_       {0};
+  detail::ReadyFd       ready_fd_;
   bool                  initialized_ = false;
+#endif
 };
 
 } // namespace ifce::os
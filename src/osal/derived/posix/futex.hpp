@@ -0,0 +1,105 @@
+#pragma once
+
+#if !defined(__linux__)
+  #error "OSAL_POSIX_FUTEX requires Linux"
+#endif
+
+#include "osal/types.hpp"
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <ctime>
+#include <cerrno>
+#include <climits>
+#include <atomic>
+
+namespace ifce::os::detail {
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t)
+              && std::atomic<uint32_t>::is_always_lock_free,
+              "futex words must be plain lock-free 32-bit atomics");
+
+/// Sleep while `*word == expected`, until woken or `deadline` passes.
+/// FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC time, matching
+/// Deadline. Returns false only on timeout; wakeups may be spurious.
+inline bool FutexWait(std::atomic<uint32_t>* word, uint32_t expected, const Deadline& deadline)
+{
+  struct timespec ts = deadline.ToTimespec();
+  long rc = syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT_BITSET_PRIVATE,
+                    expected, deadline.IsNever() ? nullptr : &ts, nullptr,
+                    FUTEX_BITSET_MATCH_ANY);
+  return !(rc == -1 && errno == ETIMEDOUT);
+}
+
+inline void FutexWake(std::atomic<uint32_t>* word, int count)
+{
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE_PRIVATE,
+          count, nullptr, nullptr, 0);
+}
+
+/// Three-state futex mutex: 0 unlocked, 1 locked, 2 locked with waiters.
+/// Uncontended lock/unlock is one atomic each and never enters the kernel.
+class FutexMutex
+{
+public:
+  void Lock()
+  {
+    uint32_t c = 0;
+    if (state_.compare_exchange_strong(c, 1, std::memory_order_acquire)) return;
+    if (c != 2) c = state_.exchange(2, std::memory_order_acquire);
+    while (c != 0) {
+      FutexWait(&state_, 2, Deadline::Never());
+      c = state_.exchange(2, std::memory_order_acquire);
+    }
+  }
+
+  void Unlock()
+  {
+    if (state_.fetch_sub(1, std::memory_order_release) != 1) {
+      state_.store(0, std::memory_order_release);
+      FutexWake(&state_, 1);
+    }
+  }
+
+private:
+  std::atomic<uint32_t> state_ {0};
+};
+
+/// Condition variable over a futex sequence word.
+/// Signal/Broadcast must be called with the mutex held; they skip the
+/// syscall entirely while nobody is waiting.
+class FutexCondition
+{
+public:
+  /// Returns false on timeout. The mutex is held again on return.
+  bool Wait(FutexMutex& mutex, const Deadline& deadline)
+  {
+    ++waiters_;
+    uint32_t seq = seq_.load(std::memory_order_relaxed);
+    mutex.Unlock();
+    bool ok = FutexWait(&seq_, seq, deadline);
+    mutex.Lock();
+    --waiters_;
+    return ok;
+  }
+
+  void Signal()
+  {
+    if (waiters_ == 0) return;
+    seq_.fetch_add(1, std::memory_order_relaxed);
+    FutexWake(&seq_, 1);
+  }
+
+  void Broadcast()
+  {
+    if (waiters_ == 0) return;
+    seq_.fetch_add(1, std::memory_order_relaxed);
+    FutexWake(&seq_, INT_MAX);
+  }
+
+private:
+  std::atomic<uint32_t> seq_     {0};
+  uint32_t              waiters_ = 0;
+};
+
+} // namespace ifce::os::detail
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "osal/basic_mailbox.hpp"
+#include "osal/derived/posix/parking_lot.hpp"
+
+namespace ifce::os {
+
+template <typename T>
+using Mailbox = BasicMailbox<T, detail::ParkingLot>;
+
+} // namespace ifce::os
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "osal/basic_message_buffer.hpp"
+#include "osal/derived/posix/stream_buffer.hpp"
+
+namespace ifce::os {
+
+using MessageBuffer = BasicMessageBuffer<StreamBuffer>;
+
+} // namespace ifce::os
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "osal/basic_mpmc_message_queue.hpp"
+#include "osal/derived/posix/parking_lot.hpp"
+
+namespace ifce::os {
+
+template <typename T>
+using MpmcMessageQueue = BasicMpmcMessageQueue<T, detail::ParkingLot>;
+
+} // namespace ifce::os
@@ -1,8 +1,9 @@
 #pragma once
 
 #include "osal/ability/mutex.hpp"
+#include "osal/derived/posix/clock.hpp"
+#include "osal/derived/posix/spin.hpp"
 #include <pthread.h>
-#include <ctime>
 #include <cerrno>
 
 namespace ifce::os {
@@ -17,7 +18,9 @@ public:
   ~Mutex() { DeleteImpl(); }
 
 private:
-  OsStatus CreateImpl(bool recursive)
+  OsStatus CreateImpl(bool recursive) { return CreateImpl(recursive, SpinPolicy{}); }
+
+  OsStatus CreateImpl(bool recursive, const SpinPolicy& spin)
   {
     if (initialized_) return OsStatus::Busy;
     pthread_mutexattr_t attr;
@@ -29,6 +32,7 @@ private:
     int rc = pthread_mutex_init(&mutex_, &attr);
     pthread_mutexattr_destroy(&attr);
     if (rc != 0) return OsStatus::Error;
+    spinner_.Configure(spin);
     initialized_ = true;
     return OsStatus::Ok;
   }
@@ -41,21 +45,20 @@ private:
     return OsStatus::Ok;
   }
 
-  OsStatus LockImpl(uint32_t timeout_ms)
+  OsStatus LockImpl(uint32_t timeout_ms) { return LockImpl(Deadline::FromTimeout(timeout_ms)); }
+
+  OsStatus LockImpl(const Deadline& deadline)
   {
     if (!initialized_) return OsStatus::Error;
-    if (timeout_ms == WaitForever) {
+    auto try_lock = [this] { return pthread_mutex_trylock(&mutex_) == 0; };
+    if (try_lock()) return OsStatus::Ok;
+    if (deadline.Expired()) return OsStatus::Timeout;
+    if (spinner_.Spin(try_lock)) return OsStatus::Ok;
+    spinner_.Parked();
+
+    if (deadline.IsNever())
       return (pthread_mutex_lock(&mutex_) == 0) ? OsStatus::Ok : OsStatus::Error;
-    }
-    struct timespec ts;
-    clock_gettime(CLOCK_REALTIME, &ts);
-    ts.tv_sec  += timeout_ms / 1000;
-    ts.tv_nsec += (timeout_ms % 1000) * 1000000L;
-    if (ts.tv_nsec >= 1000000000L) {
-      ts.tv_sec  += 1;
-      ts.tv_nsec -= 1000000000L;
-    }
-    int rc = pthread_mutex_timedlock(&mutex_, &ts);
+    int rc = detail::MutexLockUntil(&mutex_, deadline);
     if (rc == 0)          return OsStatus::Ok;
     if (rc == ETIMEDOUT)  return OsStatus::Timeout;
     return OsStatus::Error;
@@ -76,8 +79,11 @@ private:
     return OsStatus::Error;
   }
 
+  SpinStats GetSpinStatsImpl() const { return spinner_.Stats(); }
+
 private:
   pthread_mutex_t mutex_       = PTHREAD_MUTEX_INITIALIZER;
+  detail::Spinner spinner_;
   bool            initialized_ = false;
 };
 
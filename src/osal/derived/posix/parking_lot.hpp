@@ -0,0 +1,106 @@
+#pragma once
+
+#include "osal/types.hpp"
+#include "osal/derived/posix/clock.hpp"
+#include "osal/derived/posix/spin.hpp"
+#include <pthread.h>
+#include <atomic>
+
+namespace ifce::os::detail {
+
+/// Slow-path parking for the lock-free primitives.
+///
+/// Waiters only take the mutex after their fast-path check failed, and
+/// notifiers skip the mutex/condvar entirely while nobody is parked.
+class ParkingLot
+{
+public:
+  ParkingLot()
+  {
+    pthread_mutex_init(&mutex_, nullptr);
+    InitMonotonicCond(&cond_);
+  }
+
+  ~ParkingLot()
+  {
+    pthread_cond_destroy(&cond_);
+    pthread_mutex_destroy(&mutex_);
+  }
+
+  ParkingLot(const ParkingLot&)            = delete;
+  ParkingLot& operator=(const ParkingLot&) = delete;
+
+  /// Nothing to allocate here; lots backed by a kernel object make it in Open().
+  bool Open()  { return true; }
+  void Close() {}
+
+  void      Configure(const SpinPolicy& policy) { spinner_.Configure(policy); }
+  SpinStats Stats() const { return spinner_.Stats(); }
+
+  /// Pause between retries of a lock-free loop that cannot park.
+  static void Backoff(uint32_t& attempt) { detail::Backoff(attempt); }
+
+  /// Spin, then block until ready() returns true or the timeout expires.
+  /// Returns the final value of ready().
+  template <typename Pred>
+  bool Wait(Pred&& ready, uint32_t timeout_ms)
+  {
+    if (ready()) return true;
+    if (timeout_ms == 0) return false;
+    return Wait(ready, Deadline::FromTimeout(timeout_ms));
+  }
+
+  template <typename Pred>
+  bool Wait(Pred&& ready, const Deadline& deadline)
+  {
+    if (ready()) return true;
+    if (deadline.Expired()) return false;
+    if (spinner_.Spin(ready)) return true;
+    spinner_.Parked();
+
+    pthread_mutex_lock(&mutex_);
+    waiters_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    bool ok = true;
+    while (!ready()) {
+      if (deadline.IsNever()) {
+        pthread_cond_wait(&cond_, &mutex_);
+      } else if (!CondWaitUntil(&cond_, &mutex_, deadline)) {
+        ok = ready();
+        break;
+      }
+    }
+
+    waiters_.fetch_sub(1, std::memory_order_relaxed);
+    pthread_mutex_unlock(&mutex_);
+    return ok;
+  }
+
+  /// Must be called after the state change that makes ready() true.
+  void NotifyOne()
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_relaxed) == 0) return;
+    pthread_mutex_lock(&mutex_);
+    pthread_cond_signal(&cond_);
+    pthread_mutex_unlock(&mutex_);
+  }
+
+  void NotifyAll()
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_relaxed) == 0) return;
+    pthread_mutex_lock(&mutex_);
+    pthread_cond_broadcast(&cond_);
+    pthread_mutex_unlock(&mutex_);
+  }
+
+private:
+  pthread_mutex_t       mutex_   = PTHREAD_MUTEX_INITIALIZER;
+  pthread_cond_t        cond_    = PTHREAD_COND_INITIALIZER;
+  std::atomic<uint32_t> waiters_ {0};
+  Spinner               spinner_;
+};
+
+} // namespace ifce::os::detail
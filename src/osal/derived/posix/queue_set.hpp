@@ -0,0 +1,171 @@
+#pragma once
+
+#include "osal/ability/queue_set.hpp"
+#include "osal/derived/posix/clock.hpp"
+#include <pthread.h>
+#include <new>
+
+namespace ifce::os {
+
+template <typename, typename> class BasicMessageQueue;
+class Semaphore;
+
+/// Members post their own address into a ring of pending events every time
+/// they publish an item, so Select() is a pop regardless of member count.
+class QueueSet : public QueueSetAbility<QueueSet>
+{
+  friend class QueueSetAbility<QueueSet>;
+  friend class ifce::DispatchBase<QueueSet>;
+  template <typename, typename> friend class BasicMessageQueue;
+  friend class Semaphore;
+
+public:
+  QueueSet()  = default;
+  ~QueueSet() { DeleteImpl(); }
+
+private:
+  OsStatus CreateImpl(uint32_t max_events)
+  {
+    if (events_) return OsStatus::Busy;
+    if (max_events == 0) return OsStatus::Error;
+    events_ = new (std::nothrow) const void*[max_events];
+    if (!events_) return OsStatus::NoMemory;
+    pthread_mutex_init(&mutex_, nullptr);
+    detail::InitMonotonicCond(&cond_);
+    capacity_ = max_events;
+    head_     = 0;
+    count_    = 0;
+    return OsStatus::Ok;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    if (!events_) return OsStatus::Ok;
+    UnbindAll();
+    pthread_cond_destroy(&cond_);
+    pthread_mutex_destroy(&mutex_);
+    delete[] events_;
+    events_   = nullptr;
+    capacity_ = 0;
+    return OsStatus::Ok;
+  }
+
+  template <typename Member>
+  OsStatus AddImpl(Member& member)
+  {
+    if (!events_) return OsStatus::Error;
+    if (member.queue_set_ || member.GetCount() != 0) return OsStatus::Busy;
+    member.set_hook_ = detail::QueueSetHook{
+      members_, &member, [](void* m) { static_cast<Member*>(m)->BindQueueSet(nullptr); }};
+    members_ = &member.set_hook_;
+    member.BindQueueSet(this);
+    return OsStatus::Ok;
+  }
+
+  template <typename Member>
+  OsStatus RemoveImpl(Member& member)
+  {
+    if (!events_ || member.queue_set_ != this) return OsStatus::Error;
+    if (member.GetCount() != 0) return OsStatus::Busy;
+    Detach(member);
+    return OsStatus::Ok;
+  }
+
+  /// Unbinds `member` and drops its pending events. Also called by a member
+  /// being deleted, whatever it still holds.
+  template <typename Member>
+  void Detach(Member& member)
+  {
+    member.BindQueueSet(nullptr);
+    for (detail::QueueSetHook** link = &members_; *link; link = &(*link)->next) {
+      if (*link == &member.set_hook_) {
+        *link = member.set_hook_.next;
+        break;
+      }
+    }
+
+    // Drop events left behind by items that were read without a Select
+    pthread_mutex_lock(&mutex_);
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < count_; ++i) {
+      const void* ev = events_[(head_ + i) % capacity_];
+      if (ev != &member)
+        events_[(head_ + kept++) % capacity_] = ev;
+    }
+    count_ = kept;
+    pthread_mutex_unlock(&mutex_);
+  }
+
+  /// Members left attached would otherwise post into a dead set.
+  void UnbindAll()
+  {
+    while (members_) {
+      detail::QueueSetHook* hook = members_;
+      members_ = hook->next;
+      hook->unbind(hook->member);
+    }
+  }
+
+  const void* SelectImpl(uint32_t timeout_ms) { return SelectImpl(Deadline::FromTimeout(timeout_ms)); }
+
+  const void* SelectImpl(const Deadline& deadline)
+  {
+    if (!events_) return nullptr;
+    pthread_mutex_lock(&mutex_);
+    while (count_ == 0) {
+      if (deadline.IsNever()) {
+        pthread_cond_wait(&cond_, &mutex_);
+      } else if (deadline.Expired() || !detail::CondWaitUntil(&cond_, &mutex_, deadline)) {
+        if (count_ != 0) break;
+        pthread_mutex_unlock(&mutex_);
+        return nullptr;
+      }
+    }
+    const void* member = events_[head_];
+    head_ = (head_ + 1) % capacity_;
+    --count_;
+    pthread_mutex_unlock(&mutex_);
+    return member;
+  }
+
+  /// Called by a member after it published one item. Never blocks; an
+  /// event is dropped only if `max_events` was sized below the members'
+  /// combined capacity.
+  void Post(const void* member)
+  {
+    pthread_mutex_lock(&mutex_);
+    if (count_ < capacity_) {
+      events_[(head_ + count_) % capacity_] = member;
+      ++count_;
+      pthread_cond_signal(&cond_);
+    }
+    pthread_mutex_unlock(&mutex_);
+  }
+
+  /// Called by a member that discarded a queued item without a Select
+  /// (overflow eviction), so the ring keeps one event per queued item.
+  /// Drops the member's newest pending event, if any.
+  void Retract(const void* member)
+  {
+    pthread_mutex_lock(&mutex_);
+    for (uint32_t i = count_; i-- > 0;) {
+      if (events_[(head_ + i) % capacity_] != member) continue;
+      for (uint32_t j = i; j + 1 < count_; ++j)
+        events_[(head_ + j) % capacity_] = events_[(head_ + j + 1) % capacity_];
+      --count_;
+      break;
+    }
+    pthread_mutex_unlock(&mutex_);
+  }
+
+private:
+  pthread_mutex_t       mutex_    = PTHREAD_MUTEX_INITIALIZER;
+  pthread_cond_t        cond_     = PTHREAD_COND_INITIALIZER;
+  const void**          events_   = nullptr;
+  detail::QueueSetHook* members_  = nullptr;
+  uint32_t              capacity_ = 0;
+  uint32_t              head_     = 0;
+  uint32_t              count_    = 0;
+};
+
+} // namespace ifce::os
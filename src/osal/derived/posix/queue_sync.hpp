@@ -0,0 +1,76 @@
+#pragma once
+
+#include "osal/derived/posix/clock.hpp"
+#include "osal/derived/posix/queue_set.hpp"
+#include "osal/derived/posix/ready_fd.hpp"
+#include "osal/derived/posix/spin.hpp"
+#if defined(OSAL_POSIX_FUTEX)
+  #include "osal/derived/posix/futex.hpp"
+#endif
+#include <pthread.h>
+
+namespace ifce::os::detail {
+
+/// pthread mutex with the FutexMutex interface.
+class PthreadMutex
+{
+public:
+  PthreadMutex()  = default;
+  ~PthreadMutex() { pthread_mutex_destroy(&mutex_); }
+
+  PthreadMutex(const PthreadMutex&)            = delete;
+  PthreadMutex& operator=(const PthreadMutex&) = delete;
+
+  /// Statically initialized; Open/Close only satisfy BasicMemoryPool.
+  bool Open()  { return true; }
+  void Close() {}
+
+  void Lock()   { pthread_mutex_lock(&mutex_); }
+  void Unlock() { pthread_mutex_unlock(&mutex_); }
+
+private:
+  friend class PthreadCondition;
+  pthread_mutex_t mutex_ = PTHREAD_MUTEX_INITIALIZER;
+};
+
+/// Monotonic-clock pthread condvar with the FutexCondition interface.
+class PthreadCondition
+{
+public:
+  PthreadCondition()  { InitMonotonicCond(&cond_); }
+  ~PthreadCondition() { pthread_cond_destroy(&cond_); }
+
+  PthreadCondition(const PthreadCondition&)            = delete;
+  PthreadCondition& operator=(const PthreadCondition&) = delete;
+
+  /// Returns false on timeout. The mutex is held again on return.
+  bool Wait(PthreadMutex& mutex, const Deadline& deadline)
+  {
+    if (deadline.IsNever()) return pthread_cond_wait(&cond_, &mutex.mutex_) == 0;
+    return CondWaitUntil(&cond_, &mutex.mutex_, deadline);
+  }
+
+  void Signal()    { pthread_cond_signal(&cond_); }
+  void Broadcast() { pthread_cond_broadcast(&cond_); }
+
+private:
+  pthread_cond_t cond_;
+};
+
+/// BasicMessageQueue's lock and wait primitives: futex words with
+/// OSAL_POSIX_FUTEX, else pthread.
+struct QueueSync
+{
+#if defined(OSAL_POSIX_FUTEX)
+  using Mutex = FutexMutex;
+  using Cond  = FutexCondition;
+#else
+  using Mutex = PthreadMutex;
+  using Cond  = PthreadCondition;
+#endif
+  using Spinner  = detail::Spinner;
+  using ReadyFd  = detail::ReadyFd;
+  using QueueSet = os::QueueSet;
+};
+
+} // namespace ifce::os::detail
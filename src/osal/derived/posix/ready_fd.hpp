@@ -0,0 +1,110 @@
+#pragma once
+
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <atomic>
+#include <cstdint>
+#if defined(__linux__)
+  #include <sys/eventfd.h>
+#endif
+
+namespace ifce::os::detail {
+
+/// Level-triggered readiness descriptor for epoll/poll/select loops.
+///
+/// The descriptor polls readable exactly while its owner is ready. It is
+/// only opened on the first Open() call; until then Refresh() is one
+/// relaxed load. Once open, Refresh() re-evaluates `ready()` under an
+/// internal lock and touches the descriptor only on a ready/not-ready edge,
+/// so the last Refresh after any state change always leaves it correct.
+/// Linux uses an eventfd; other hosts fall back to a non-blocking pipe.
+class ReadyFd
+{
+public:
+  ReadyFd()  = default;
+  ~ReadyFd() { Close(); }
+
+  ReadyFd(const ReadyFd&)            = delete;
+  ReadyFd& operator=(const ReadyFd&) = delete;
+
+  /// Returns the pollable descriptor, opening it on first use; -1 on failure.
+  template <typename Pred>
+  int Open(Pred&& ready)
+  {
+    pthread_mutex_lock(&mutex_);
+    if (read_fd_.load(std::memory_order_relaxed) < 0 && OpenFds()) {
+      // Pairs with the fence in Refresh: either that Refresh sees the fd,
+      // or the ready() below sees its state change
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      Apply(ready());
+    }
+    int fd = read_fd_.load(std::memory_order_relaxed);
+    pthread_mutex_unlock(&mutex_);
+    return fd;
+  }
+
+  /// Call after any change that may flip ready().
+  template <typename Pred>
+  void Refresh(Pred&& ready)
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (read_fd_.load(std::memory_order_relaxed) < 0) return;
+    pthread_mutex_lock(&mutex_);
+    Apply(ready());
+    pthread_mutex_unlock(&mutex_);
+  }
+
+  void Close()
+  {
+    int rfd = read_fd_.exchange(-1, std::memory_order_relaxed);
+    if (rfd < 0) return;
+    if (write_fd_ != rfd) close(write_fd_);
+    close(rfd);
+    write_fd_ = -1;
+    signaled_ = false;
+  }
+
+private:
+  bool OpenFds()
+  {
+#if defined(__linux__)
+    int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd < 0) return false;
+    write_fd_ = fd;
+    read_fd_.store(fd, std::memory_order_seq_cst);
+#else
+    int fds[2];
+    if (pipe(fds) != 0) return false;
+    for (int fd : fds) {
+      fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+      fcntl(fd, F_SETFD, FD_CLOEXEC);
+    }
+    write_fd_ = fds[1];
+    read_fd_.store(fds[0], std::memory_order_seq_cst);
+#endif
+    signaled_ = false;
+    return true;
+  }
+
+  void Apply(bool ready)
+  {
+    if (ready == signaled_) return;
+    signaled_ = ready;
+    if (ready) {
+      uint64_t one = 1;
+      (void)!write(write_fd_, &one, sizeof(one));
+    } else {
+      uint64_t buf;
+      while (read(read_fd_.load(std::memory_order_relaxed), &buf, sizeof(buf)) > 0) {}
+    }
+  }
+
+private:
+  pthread_mutex_t  mutex_    = PTHREAD_MUTEX_INITIALIZER;
+  std::atomic<int> read_fd_  {-1};
+  int              write_fd_ = -1;
+  bool             signaled_ = false;
+};
+
+} // namespace ifce::os::detail
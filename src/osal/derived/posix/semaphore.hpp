@@ -1,9 +1,15 @@
 #pragma once
 
 #include "osal/ability/semaphore.hpp"
+#include "osal/derived/posix/clock.hpp"
+#include "osal/derived/posix/queue_set.hpp"
+#include "osal/derived/posix/ready_fd.hpp"
+#include "osal/derived/posix/spin.hpp"
 #include <semaphore.h>
-#include <ctime>
 #include <cerrno>
+#if defined(OSAL_POSIX_FUTEX)
+  #include "osal/derived/posix/futex.hpp"
+#endif
 
 namespace ifce::os {
 
@@ -11,15 +17,128 @@ class Semaphore : public SemaphoreAbility<Semaphore>
 {
   friend class SemaphoreAbility<Semaphore>;
   friend class ifce::DispatchBase<Semaphore>;
+  friend class QueueSet;
 
 public:
   Semaphore()  = default;
   ~Semaphore() { DeleteImpl(); }
 
 private:
+  /// Release posts without a lock, so attach before the semaphore is shared.
+  void BindQueueSet(QueueSet* set) { queue_set_ = set; }
+
+#if defined(OSAL_POSIX_FUTEX)
+  // The count is the futex word: Acquire/Release are one atomic each and
+  // only enter the kernel when a waiter is actually parked.
+  OsStatus CreateImpl(uint32_t max_count, uint32_t initial_count)
+  {
+    return CreateImpl(max_count, initial_count, SpinPolicy{});
+  }
+
+  OsStatus CreateImpl(uint32_t max_count, uint32_t initial_count, const SpinPolicy& spin)
+  {
+    if (initialized_) return OsStatus::Busy;
+    spinner_.Configure(spin);
+    max_count_ = max_count;
+    count_.store(initial_count, std::memory_order_relaxed);
+    waiters_.store(0, std::memory_order_relaxed);
+    initialized_ = true;
+    return OsStatus::Ok;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    if (queue_set_) queue_set_->Detach(*this);
+    ready_fd_.Close();
+    initialized_ = false;
+    return OsStatus::Ok;
+  }
+
+  OsStatus AcquireImpl(uint32_t timeout_ms) { return AcquireImpl(Deadline::FromTimeout(timeout_ms)); }
+
+  OsStatus AcquireImpl(const Deadline& deadline)
+  {
+    OsStatus status = Take(deadline);
+    if (status == OsStatus::Ok) RefreshFd();
+    return status;
+  }
+
+  OsStatus Take(const Deadline& deadline)
+  {
+    if (!initialized_) return OsStatus::Error;
+    if (TryDecrement()) return OsStatus::Ok;
+    if (deadline.Expired()) return OsStatus::Timeout;
+    if (spinner_.Spin([this] { return TryDecrement(); })) return OsStatus::Ok;
+    spinner_.Parked();
+
+    waiters_.fetch_add(1, std::memory_order_seq_cst);
+    OsStatus status = OsStatus::Ok;
+    while (!TryDecrement()) {
+      if (!detail::FutexWait(&count_, 0, deadline)) {
+        status = TryDecrement() ? OsStatus::Ok : OsStatus::Timeout;
+        break;
+      }
+    }
+    waiters_.fetch_sub(1, std::memory_order_relaxed);
+    return status;
+  }
+
+  OsStatus ReleaseImpl()
+  {
+    if (!initialized_) return OsStatus::Error;
+    count_.fetch_add(1, std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_seq_cst) != 0)
+      detail::FutexWake(&count_, 1);
+    if (queue_set_) queue_set_->Post(this);
+    RefreshFd();
+    return OsStatus::Ok;
+  }
+
+  uint32_t GetCountImpl() const
+  {
+    if (!initialized_) return 0;
+    return count_.load(std::memory_order_relaxed);
+  }
+
+  SpinStats GetSpinStatsImpl() const { return spinner_.Stats(); }
+
+  int GetNativeFdImpl()
+  {
+    if (!initialized_) return -1;
+    return ready_fd_.Open([this] { return count_.load() != 0; });
+  }
+
+  void RefreshFd() { ready_fd_.Refresh([this] { return count_.load() != 0; }); }
+
+  bool TryDecrement()
+  {
+    uint32_t c = count_.load(std::memory_order_relaxed);
+    while (c != 0) {
+      if (count_.compare_exchange_weak(c, c - 1, std::memory_order_acquire))
+        return true;
+    }
+    return false;
+  }
+
+private:
+  std::atomic<uint32_t> count_       {0};
+  std::atomic<uint32_t> waiters_     {0};
+  detail::Spinner       spinner_;
+  detail::ReadyFd       ready_fd_;
+  QueueSet*             queue_set_   = nullptr;
+  detail::QueueSetHook  set_hook_;
+  uint32_t              max_count_   = 0;
+  bool                  initialized_ = false;
+#else
   OsStatus CreateImpl(uint32_t max_count, uint32_t initial_count)
+  {
+    return CreateImpl(max_count, initial_count, SpinPolicy{});
+  }
+
+  OsStatus CreateImpl(uint32_t max_count, uint32_t initial_count, const SpinPolicy& spin)
   {
     if (initialized_) return OsStatus::Busy;
+    spinner_.Configure(spin);
     max_count_ = max_count;
     if (sem_init(&sem_, 0, initial_count) != 0)
       return OsStatus::Error;
@@ -30,38 +149,47 @@ private:
   OsStatus DeleteImpl()
   {
     if (!initialized_) return OsStatus::Ok;
+    if (queue_set_) queue_set_->Detach(*this);
+    ready_fd_.Close();
     sem_destroy(&sem_);
     initialized_ = false;
     return OsStatus::Ok;
   }
 
-  OsStatus AcquireImpl(uint32_t timeout_ms)
+  OsStatus AcquireImpl(uint32_t timeout_ms) { return AcquireImpl(Deadline::FromTimeout(timeout_ms)); }
+
+  OsStatus AcquireImpl(const Deadline& deadline)
+  {
+    OsStatus status = Take(deadline);
+    if (status == OsStatus::Ok) RefreshFd();
+    return status;
+  }
+
+  OsStatus Take(const Deadline& deadline)
   {
     if (!initialized_) return OsStatus::Error;
-    if (timeout_ms == WaitForever) {
-      while (sem_wait(&sem_) != 0) {
-        if (errno != EINTR) return OsStatus::Error;
-      }
-      return OsStatus::Ok;
-    }
-    struct timespec ts;
-    clock_gettime(CLOCK_REALTIME, &ts);
-    ts.tv_sec  += timeout_ms / 1000;
-    ts.tv_nsec += (timeout_ms % 1000) * 1000000L;
-    if (ts.tv_nsec >= 1000000000L) {
-      ts.tv_sec  += 1;
-      ts.tv_nsec -= 1000000000L;
+    auto try_wait = [this] { return sem_trywait(&sem_) == 0; };
+    if (try_wait()) return OsStatus::Ok;
+    if (deadline.Expired()) return OsStatus::Timeout;
+    if (spinner_.Spin(try_wait)) return OsStatus::Ok;
+    spinner_.Parked();
+
+    // EINTR retries keep the original deadline
+    for (;;) {
+      int rc = deadline.IsNever() ? sem_wait(&sem_) : detail::SemWaitUntil(&sem_, deadline);
+      if (rc == 0)            return OsStatus::Ok;
+      if (errno == ETIMEDOUT) return OsStatus::Timeout;
+      if (errno != EINTR)     return OsStatus::Error;
     }
-    int rc = sem_timedwait(&sem_, &ts);
-    if (rc == 0)                       return OsStatus::Ok;
-    if (errno == ETIMEDOUT)            return OsStatus::Timeout;
-    return OsStatus::Error;
   }
 
   OsStatus ReleaseImpl()
   {
     if (!initialized_) return OsStatus::Error;
-    return (sem_post(&sem_) == 0) ? OsStatus::Ok : OsStatus::Error;
+    if (sem_post(&sem_) != 0) return OsStatus::Error;
+    if (queue_set_) queue_set_->Post(this);
+    RefreshFd();
+    return OsStatus::Ok;
   }
 
   uint32_t GetCountImpl() const
@@ -72,10 +200,25 @@ private:
     return (val >= 0) ? static_cast<uint32_t>(val) : 0;
   }
 
+  SpinStats GetSpinStatsImpl() const { return spinner_.Stats(); }
+
+  int GetNativeFdImpl()
+  {
+    if (!initialized_) return -1;
+    return ready_fd_.Open([this] { return GetCountImpl() != 0; });
+  }
+
+  void RefreshFd() { ready_fd_.Refresh([this] { return GetCountImpl() != 0; }); }
+
 private:
-  sem_t    sem_          = {};
-  uint32_t max_count_    = 0;
-  bool     initialized_  = false;
+  sem_t                sem_          = {};
+  detail::Spinner      spinner_;
+  detail::ReadyFd      ready_fd_;
+  QueueSet*            queue_set_    = nullptr;
+  detail::QueueSetHook set_hook_;
+  uint32_t             max_count_    = 0;
+  bool                 initialized_  = false;
+#endif
 };
 
 } // namespace ifce::os
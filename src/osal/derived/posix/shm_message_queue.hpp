@@ -0,0 +1,337 @@
+#pragma once
+
+#include "osal/ability/message_queue.hpp"
+#include <pthread.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace ifce::os {
+
+/// MessageQueue whose ring and control block live in shared memory, so
+/// separate processes exchange messages with one copy in and one copy out
+/// and no syscall unless a side has to block.
+///
+/// Create(name, capacity) opens the named queue, creating it with shm_open
+/// if it does not exist yet; every process passes the same name and
+/// capacity. Create(capacity) maps an anonymous shared region instead,
+/// which is inherited across fork(). The control block holds a robust,
+/// process-shared mutex and monotonic condvars, so a peer that dies while
+/// holding the lock does not wedge the queue.
+///
+/// Delete() only unmaps; the name lives on until Unlink(name).
+template <typename T>
+class ShmMessageQueue : public MessageQueueAbility<ShmMessageQueue<T>, T>
+{
+  static_assert(std::is_trivially_copyable_v<T>,
+    "messages cross process boundaries bytewise; T must be trivially copyable");
+  static_assert(alignof(T) <= CacheLineSize, "slot alignment exceeds the ring alignment");
+
+  friend class MessageQueueAbility<ShmMessageQueue<T>, T>;
+  friend class ifce::DispatchBase<ShmMessageQueue<T>>;
+
+public:
+  ShmMessageQueue()  = default;
+  ~ShmMessageQueue() { DeleteImpl(); }
+
+  using MessageQueueAbility<ShmMessageQueue<T>, T>::Create;
+
+  /// Open `name` (a shm_open name such as "/adc-samples"), creating and
+  /// initializing it if this is the first process. Returns Error if an
+  /// existing queue was made with a different capacity or message size,
+  /// and NotReady if its creator never finished initializing it.
+  OsStatus Create(const char* name, uint32_t capacity)
+  {
+    if (ctl_) return OsStatus::Busy;
+    if (!name || capacity == 0) return OsStatus::Error;
+
+    size_t size  = MappingSize(capacity);
+    bool   owner = true;
+    int    fd    = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0 && errno == EEXIST) {
+      owner = false;
+      fd    = shm_open(name, O_RDWR, 0600);
+    }
+    if (fd < 0) return OsStatus::Error;
+
+    OsStatus rc = OsStatus::Ok;
+    if (owner && ftruncate(fd, static_cast<off_t>(size)) != 0) rc = OsStatus::NoMemory;
+    if (!owner) rc = WaitForSize(fd, size);
+    void* mem = (rc == OsStatus::Ok)
+                ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+                : MAP_FAILED;
+    close(fd);
+    if (mem == MAP_FAILED) {
+      if (owner) shm_unlink(name);
+      return (rc == OsStatus::Ok) ? OsStatus::NoMemory : rc;
+    }
+
+    Map(mem, size);
+    if (owner) {
+      Init(capacity);
+      return OsStatus::Ok;
+    }
+    rc = WaitForInit(capacity);
+    if (rc != OsStatus::Ok) DeleteImpl();
+    return rc;
+  }
+
+  /// Remove the name; processes that already opened the queue keep it.
+  static OsStatus Unlink(const char* name)
+  {
+    return (shm_unlink(name) == 0) ? OsStatus::Ok : OsStatus::NotFound;
+  }
+
+private:
+  struct Control
+  {
+    std::atomic<uint32_t> magic {0};  // set last by the creator
+    uint32_t              capacity = 0;
+    uint32_t              msg_size = 0;
+    uint64_t              head     = 0;  // free-running; never wraps in practice
+    uint64_t              tail     = 0;
+    pthread_mutex_t       mutex;
+    pthread_cond_t        not_empty;
+    pthread_cond_t        not_full;
+  };
+
+  static_assert(std::atomic<uint32_t>::is_always_lock_free,
+    "the init flag must be address-free to be shared between processes");
+
+  static constexpr uint32_t kMagic        = 0x514D534Fu;  // "OSMQ"
+  static constexpr uint32_t kAttachTries  = 1000;         // x 1 ms
+  static constexpr size_t   kSlotsOffset  =
+    (sizeof(Control) + CacheLineSize - 1) / CacheLineSize * CacheLineSize;
+
+  static size_t MappingSize(uint32_t capacity) { return kSlotsOffset + sizeof(T) * size_t(capacity); }
+
+  OsStatus CreateImpl(uint32_t capacity)
+  {
+    if (ctl_) return OsStatus::Busy;
+    if (capacity == 0) return OsStatus::Error;
+    size_t size = MappingSize(capacity);
+    void*  mem  = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) return OsStatus::NoMemory;
+    Map(mem, size);
+    Init(capacity);
+    return OsStatus::Ok;
+  }
+
+  OsStatus DeleteImpl()
+  {
+    if (!ctl_) return OsStatus::Ok;
+    munmap(ctl_, map_size_);
+    ctl_      = nullptr;
+    slots_    = nullptr;
+    map_size_ = 0;
+    capacity_ = 0;
+    return OsStatus::Ok;
+  }
+
+  OsStatus PutImpl(const T& msg, uint32_t timeout_ms) { return PutImpl(msg, Deadline::FromTimeout(timeout_ms)); }
+
+  OsStatus PutImpl(const T& msg, const Deadline& deadline)
+  {
+    return (PutBatch(&msg, 1, deadline) == 1) ? OsStatus::Ok : Failure();
+  }
+
+  OsStatus GetImpl(T& msg, uint32_t timeout_ms) { return GetImpl(msg, Deadline::FromTimeout(timeout_ms)); }
+
+  OsStatus GetImpl(T& msg, const Deadline& deadline)
+  {
+    return (GetBatch(&msg, 1, deadline) == 1) ? OsStatus::Ok : Failure();
+  }
+
+  /// One lock round trip and one wake-up per batch instead of per message.
+  uint32_t PutManyImpl(const T* msgs, uint32_t count, uint32_t timeout_ms)
+  {
+    Deadline deadline = Deadline::FromTimeout(timeout_ms);
+    uint32_t done     = 0;
+    while (done < count) {
+      uint32_t n = PutBatch(msgs + done, count - done, deadline);
+      if (n == 0) break;
+      done += n;
+    }
+    return done;
+  }
+
+  uint32_t GetManyImpl(T* msgs, uint32_t max, uint32_t timeout_ms)
+  {
+    return GetBatch(msgs, max, Deadline::FromTimeout(timeout_ms));
+  }
+
+  uint32_t GetCountImpl() const
+  {
+    if (!ctl_) return 0;
+    Lock();
+    uint32_t count = Count();
+    pthread_mutex_unlock(&ctl_->mutex);
+    return count;
+  }
+
+  uint32_t GetCapacityImpl() const { return capacity_; }
+
+  OsStatus ResetImpl()
+  {
+    if (!ctl_) return OsStatus::Error;
+    Lock();
+    ctl_->head = ctl_->tail;
+    pthread_cond_broadcast(&ctl_->not_full);
+    pthread_mutex_unlock(&ctl_->mutex);
+    return OsStatus::Ok;
+  }
+
+  // --- Ring ---
+
+  /// Waits for room, then copies in as many of `msgs` as fit.
+  uint32_t PutBatch(const T* msgs, uint32_t count, const Deadline& deadline)
+  {
+    if (!ctl_ || count == 0) return 0;
+    Lock();
+    if (!WaitLocked(&ctl_->not_full, [this] { return Count() < capacity_; }, deadline)) {
+      pthread_mutex_unlock(&ctl_->mutex);
+      return 0;
+    }
+    uint32_t n = capacity_ - Count();
+    if (n > count) n = count;
+    for (uint32_t i = 0; i < n; ++i)
+      std::memcpy(SlotAt(ctl_->tail + i), &msgs[i], sizeof(T));
+    ctl_->tail += n;
+    Wake(&ctl_->not_empty, n);
+    pthread_mutex_unlock(&ctl_->mutex);
+    return n;
+  }
+
+  /// Waits for one message, then copies out as many as are queued.
+  uint32_t GetBatch(T* msgs, uint32_t max, const Deadline& deadline)
+  {
+    if (!ctl_ || max == 0) return 0;
+    Lock();
+    if (!WaitLocked(&ctl_->not_empty, [this] { return Count() > 0; }, deadline)) {
+      pthread_mutex_unlock(&ctl_->mutex);
+      return 0;
+    }
+    uint32_t n = Count();
+    if (n > max) n = max;
+    for (uint32_t i = 0; i < n; ++i)
+      std::memcpy(&msgs[i], SlotAt(ctl_->head + i), sizeof(T));
+    ctl_->head += n;
+    Wake(&ctl_->not_full, n);
+    pthread_mutex_unlock(&ctl_->mutex);
+    return n;
+  }
+
+  static void Wake(pthread_cond_t* cond, uint32_t n)
+  {
+    if (n == 1) pthread_cond_signal(cond);
+    else        pthread_cond_broadcast(cond);
+  }
+
+  uint32_t Count() const { return static_cast<uint32_t>(ctl_->tail - ctl_->head); }
+
+  /// Every ring update is a single store after the copy, so a peer that
+  /// died holding the lock left the ring consistent; just reclaim it.
+  void Lock() const
+  {
+    if (pthread_mutex_lock(&ctl_->mutex) == EOWNERDEAD)
+      pthread_mutex_consistent(&ctl_->mutex);
+  }
+
+  template <typename Pred>
+  bool WaitLocked(pthread_cond_t* cond, Pred ready, const Deadline& deadline)
+  {
+    while (!ready()) {
+      if (deadline.Expired()) return false;
+      int rc = deadline.IsNever() ? pthread_cond_wait(cond, &ctl_->mutex)
+                                  : TimedWait(cond, deadline);
+      if (rc == EOWNERDEAD) pthread_mutex_consistent(&ctl_->mutex);
+      else if (rc == ETIMEDOUT) return ready();
+    }
+    return true;
+  }
+
+  int TimedWait(pthread_cond_t* cond, const Deadline& deadline)
+  {
+    struct timespec ts = deadline.ToTimespec();
+    return pthread_cond_timedwait(cond, &ctl_->mutex, &ts);
+  }
+
+  OsStatus Failure() const { return ctl_ ? OsStatus::Timeout : OsStatus::Error; }
+
+  // --- Mapping ---
+
+  void Map(void* mem, size_t size)
+  {
+    ctl_      = static_cast<Control*>(mem);
+    slots_    = static_cast<uint8_t*>(mem) + kSlotsOffset;
+    map_size_ = size;
+  }
+
+  void Init(uint32_t capacity)
+  {
+    ctl_ = new (ctl_) Control();
+    ctl_->capacity = capacity;
+    ctl_->msg_size = sizeof(T);
+
+    pthread_mutexattr_t ma;
+    pthread_mutexattr_init(&ma);
+    pthread_mutexattr_setpshared(&ma, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&ma, PTHREAD_MUTEX_ROBUST);
+    pthread_mutex_init(&ctl_->mutex, &ma);
+    pthread_mutexattr_destroy(&ma);
+
+    pthread_condattr_t ca;
+    pthread_condattr_init(&ca);
+    pthread_condattr_setpshared(&ca, PTHREAD_PROCESS_SHARED);
+    pthread_condattr_setclock(&ca, CLOCK_MONOTONIC);
+    pthread_cond_init(&ctl_->not_empty, &ca);
+    pthread_cond_init(&ctl_->not_full, &ca);
+    pthread_condattr_destroy(&ca);
+
+    capacity_ = capacity;
+    ctl_->magic.store(kMagic, std::memory_order_release);
+  }
+
+  /// The creator may not have sized the object yet.
+  static OsStatus WaitForSize(int fd, size_t size)
+  {
+    for (uint32_t i = 0; i < kAttachTries; ++i) {
+      struct stat st;
+      if (fstat(fd, &st) != 0) return OsStatus::Error;
+      if (st.st_size != 0)
+        return (static_cast<size_t>(st.st_size) == size) ? OsStatus::Ok : OsStatus::Error;
+      usleep(1000);
+    }
+    return OsStatus::NotReady;
+  }
+
+  OsStatus WaitForInit(uint32_t capacity)
+  {
+    for (uint32_t i = 0; i < kAttachTries; ++i) {
+      if (ctl_->magic.load(std::memory_order_acquire) == kMagic) {
+        if (ctl_->capacity != capacity || ctl_->msg_size != sizeof(T))
+          return OsStatus::Error;
+        capacity_ = capacity;
+        return OsStatus::Ok;
+      }
+      usleep(1000);
+    }
+    return OsStatus::NotReady;
+  }
+
+  uint8_t* SlotAt(uint64_t index) { return slots_ + sizeof(T) * (index % capacity_); }
+
+private:
+  Control* ctl_      = nullptr;
+  uint8_t* slots_    = nullptr;
+  size_t   map_size_ = 0;
+  uint32_t capacity_ = 0;  // local copy; never trust the shared one after attach
+};
+
+} // namespace ifce::os
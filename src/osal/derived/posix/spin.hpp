@@ -0,0 +1,21 @@
+#pragma once
+
+#include "osal/basic_spinner.hpp"
+#include <sched.h>
+#include <unistd.h>
+
+namespace ifce::os::detail {
+
+inline void YieldThread() { sched_yield(); }
+
+inline bool Uniprocessor()
+{
+  static const bool one = sysconf(_SC_NPROCESSORS_ONLN) == 1;
+  return one;
+}
+
+inline void Backoff(uint32_t& attempt) { BasicBackoff<YieldThread>(attempt); }
+
+using Spinner = BasicSpinner<YieldThread, Uniprocessor>;
+
+} // namespace ifce::os::detail
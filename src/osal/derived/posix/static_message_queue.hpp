@@ -0,0 +1,43 @@
+#pragma once
+
+#include "osal/derived/posix/message_queue.hpp"
+
+namespace ifce::os {
+
+/// MessageQueue with its N slots stored inline, so neither Create nor the
+/// steady state touches the heap. Create() takes no capacity; the heap and
+/// allocator overloads of MessageQueue::Create are hidden.
+template <typename T, uint32_t N>
+class StaticMessageQueue : public MessageQueue<T>
+{
+  static_assert(N > 0, "StaticMessageQueue needs at least one slot");
+
+  using Queue = MessageQueue<T>;
+
+public:
+  static constexpr uint32_t kCapacity = N;
+
+  StaticMessageQueue()  = default;
+  ~StaticMessageQueue() { Queue::Delete(); }
+
+  OsStatus Create(const SpinPolicy& spin = SpinPolicy{})
+  {
+    Allocator inline_storage;
+    inline_storage.allocate   = [](size_t, size_t, void* ctx) { return ctx; };
+    inline_storage.deallocate = [](void*, size_t, size_t, void*) {};
+    inline_storage.ctx        = storage_;
+    return Queue::Create(N, inline_storage, spin);
+  }
+
+  OsStatus Create(OverflowPolicy policy, const SpinPolicy& spin = SpinPolicy{})
+  {
+    OsStatus rc = Create(spin);
+    if (rc == OsStatus::Ok) Queue::policy_ = policy;
+    return rc;
+  }
+
+private:
+  alignas(Queue::kStorageAlign) unsigned char storage_[Queue::StorageSize(N)];
+};
+
+} // namespace ifce::os
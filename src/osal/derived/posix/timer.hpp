@@ -1,12 +1,16 @@
 #pragma once
 
 #include "osal/ability/timer.hpp"
+#include "osal/derived/posix/clock.hpp"
 #include <pthread.h>
 #include <ctime>
 #include <atomic>
 
 namespace ifce::os {
 
+/// Software timer on a dedicated pthread. Auto-reload timers keep a fixed
+/// schedule (Deadline::NextSlot): a callback that overruns skips the
+/// periods it missed instead of firing back to back to catch up.
 class Timer : public TimerAbility<Timer>
 {
   friend class TimerAbility<Timer>;
@@ -44,7 +48,7 @@ private:
     running_.store(true);
 
     pthread_mutex_init(&timer_mutex_, nullptr);
-    pthread_cond_init(&timer_cond_, nullptr);
+    detail::InitMonotonicCond(&timer_cond_);
 
     int rc = pthread_create(&thread_, nullptr, &TimerThread, this);
     if (rc != 0) {
@@ -81,16 +85,13 @@ private:
   static void* TimerThread(void* pv)
   {
     auto* self = static_cast<Timer*>(pv);
+    // Fire on a fixed monotonic schedule so callback time does not drift it
+    Deadline next = Deadline::In(Duration::Millis(self->period_ms_));
     do {
       // Wait for period
       pthread_mutex_lock(&self->timer_mutex_);
-      struct timespec ts;
-      clock_gettime(CLOCK_REALTIME, &ts);
-      uint32_t ms = self->period_ms_;
-      ts.tv_sec  += ms / 1000;
-      ts.tv_nsec += (ms % 1000) * 1000000L;
-      if (ts.tv_nsec >= 1000000000L) { ts.tv_sec++; ts.tv_nsec -= 1000000000L; }
-      pthread_cond_timedwait(&self->timer_cond_, &self->timer_mutex_, &ts);
+      while (self->running_.load()
+             && detail::CondWaitUntil(&self->timer_cond_, &self->timer_mutex_, next)) {}
       pthread_mutex_unlock(&self->timer_mutex_);
 
       if (!self->running_.load()) break;
@@ -98,6 +99,7 @@ private:
       if (self->callback_)
         self->callback_(self->user_arg_);
 
+      next = next.NextSlot(Duration::Millis(self->period_ms_));
     } while (self->auto_reload_ && self->running_.load());
 
     self->running_.store(false);
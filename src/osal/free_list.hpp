@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace ifce::os::detail {
+
+/// Lock-free LIFO of block indices (a Treiber stack) for fixed-block pools.
+///
+/// The head packs the top index with a generation tag that every pop bumps,
+/// so a CAS prepared against a head that was popped and pushed back in the
+/// meantime fails instead of corrupting the list (ABA). Links live in a side
+/// array rather than inside the free blocks, so reading a link never races
+/// with the block's new owner writing its payload.
+///
+/// The head is 64 bits (32-bit index and tag) where that CAS is lock-free,
+/// otherwise 32 bits (16-bit index and tag, so at most 65535 blocks).
+class IndexFreeList
+{
+  using Head = std::conditional_t<std::atomic<uint64_t>::is_always_lock_free, uint64_t, uint32_t>;
+
+  static constexpr uint32_t kIndexBits = sizeof(Head) * 4;
+  static constexpr Head     kIndexMask = (Head(1) << kIndexBits) - 1;
+
+public:
+  static constexpr uint32_t kNil      = static_cast<uint32_t>(kIndexMask);
+  static constexpr uint32_t kMaxCount = kNil;
+
+  IndexFreeList()  = default;
+  ~IndexFreeList() { Destroy(); }
+
+  IndexFreeList(const IndexFreeList&)            = delete;
+  IndexFreeList& operator=(const IndexFreeList&) = delete;
+
+  /// Starts with all `count` indices free, lowest index on top.
+  bool Init(uint32_t count)
+  {
+    if (links_ || count > kMaxCount) return false;
+    links_ = new (std::nothrow) std::atomic<uint32_t>[count ? count : 1];
+    if (!links_) return false;
+    owned_ = true;
+    Reset(count);
+    return true;
+  }
+
+  /// Same, keeping the links in caller-provided raw storage of at least
+  /// StorageSize(count) bytes, suitably aligned for std::atomic<uint32_t>.
+  bool Init(uint32_t count, void* storage)
+  {
+    if (links_ || count > kMaxCount || !storage) return false;
+    links_ = static_cast<std::atomic<uint32_t>*>(storage);
+    for (uint32_t i = 0; i < count; ++i) new (&links_[i]) std::atomic<uint32_t>(kNil);
+    owned_ = false;
+    Reset(count);
+    return true;
+  }
+
+  static constexpr size_t StorageSize(uint32_t count) { return count * sizeof(std::atomic<uint32_t>); }
+
+  void Destroy()
+  {
+    if (owned_) delete[] links_;
+    links_ = nullptr;
+    owned_ = false;
+    head_.store(Pack(kNil, 0), std::memory_order_relaxed);
+    free_.store(0, std::memory_order_relaxed);
+  }
+
+  /// Returns a free index, or kNil when the list is empty.
+  uint32_t Pop()
+  {
+    Head head = head_.load(std::memory_order_acquire);
+    for (;;) {
+      uint32_t idx = IndexOf(head);
+      if (idx == kNil) return kNil;
+      uint32_t next = links_[idx].load(std::memory_order_relaxed);
+      if (head_.compare_exchange_weak(head, Pack(next, TagOf(head) + 1),
+                                      std::memory_order_acquire, std::memory_order_acquire)) {
+        free_.fetch_sub(1, std::memory_order_relaxed);
+        return idx;
+      }
+    }
+  }
+
+  void Push(uint32_t idx)
+  {
+    // Count first, so a racing Pop of this index never drives free_ below zero
+    free_.fetch_add(1, std::memory_order_relaxed);
+    Head head = head_.load(std::memory_order_relaxed);
+    do {
+      links_[idx].store(IndexOf(head), std::memory_order_relaxed);
+    } while (!head_.compare_exchange_weak(head, Pack(idx, TagOf(head)),
+                                          std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  /// Pushes `count` indices with a single CAS; idx[0] ends up on top.
+  void PushChain(const uint32_t* idx, uint32_t count)
+  {
+    if (count == 0) return;
+    for (uint32_t i = 0; i + 1 < count; ++i)
+      links_[idx[i]].store(idx[i + 1], std::memory_order_relaxed);
+    free_.fetch_add(count, std::memory_order_relaxed);
+    uint32_t last = idx[count - 1];
+    Head head = head_.load(std::memory_order_relaxed);
+    do {
+      links_[last].store(IndexOf(head), std::memory_order_relaxed);
+    } while (!head_.compare_exchange_weak(head, Pack(idx[0], TagOf(head)),
+                                          std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  /// Relaxed snapshot; may briefly count a block that is still being pushed.
+  uint32_t Size() const { return free_.load(std::memory_order_relaxed); }
+
+private:
+  void Reset(uint32_t count)
+  {
+    for (uint32_t i = 0; i < count; ++i)
+      links_[i].store(i + 1 < count ? i + 1 : kNil, std::memory_order_relaxed);
+    head_.store(Pack(count ? 0 : kNil, 0), std::memory_order_relaxed);
+    free_.store(count, std::memory_order_relaxed);
+  }
+
+  static Head     Pack(uint32_t idx, Head tag) { return (tag << kIndexBits) | (Head(idx) & kIndexMask); }
+  static uint32_t IndexOf(Head head)           { return static_cast<uint32_t>(head & kIndexMask); }
+  static Head     TagOf(Head head)             { return head >> kIndexBits; }
+
+  std::atomic<Head>      head_ {Pack(kNil, 0)};
+  std::atomic<uint32_t>  free_ {0};
+  std::atomic<uint32_t>* links_ = nullptr;
+  bool                   owned_ = false;
+};
+
+} // namespace ifce::os::detail
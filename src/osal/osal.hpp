@@ -11,9 +11,21 @@
 #include "osal/mutex.hpp"
 #include "osal/semaphore.hpp"
 #include "osal/message_queue.hpp"
+#include "osal/static_message_queue.hpp"
+#include "osal/spsc_message_queue.hpp"
+#include "osal/mpmc_message_queue.hpp"
 #include "osal/event_flags.hpp"
+#include "osal/queue_set.hpp"
+#include "osal/mailbox.hpp"
+#include "osal/stream_buffer.hpp"
+#include "osal/message_buffer.hpp"
 #include "osal/timer.hpp"
 #include "osal/memory_pool.hpp"
+#include "osal/pool_cache.hpp"
+#include "osal/pool_ptr.hpp"
+#include "osal/slab_allocator.hpp"
+#include "osal/topic.hpp"
 #include "osal/delay.hpp"
 
 // Logger is an independent module — use #include "logger/logger.hpp" directly
+// ShmMessageQueue is POSIX-only — use #include "osal/shm_message_queue.hpp" directly
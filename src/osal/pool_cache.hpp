@@ -0,0 +1,104 @@
+#pragma once
+
+#include "osal/types.hpp"
+#include "osal/memory_pool.hpp"
+#include <cstdint>
+
+namespace ifce::os {
+
+/// Per-thread magazine cache in front of a MemoryPool.
+///
+/// Alloc and Free are served from a stack of up to `M` blocks owned by the
+/// cache (the loaded magazine) without touching the pool's lock or free
+/// list head. When the loaded magazine runs dry, Alloc swaps in the spare
+/// or refills it from the pool with one AllocBatch. When both are full,
+/// Free hands the spare back with one FreeBatch. A cache therefore never
+/// holds more than 2*M blocks, however one-sided its traffic is. A consumer
+/// thread that only frees blocks allocated by a producer returns them to
+/// the pool M at a time.
+///
+/// Not thread-safe: give each thread its own cache, e.g. a local in the
+/// thread function or a thread_local. Flush() returns every cached block;
+/// the destructor calls it, and it must run before the pool is deleted.
+template <typename T, uint32_t M = 16>
+class PoolCache
+{
+  static_assert(M > 0, "PoolCache magazine size must be non-zero");
+
+public:
+  static constexpr uint32_t kMagazineSize = M;
+
+  explicit PoolCache(MemoryPool<T>& pool) : pool_(&pool) {}
+  ~PoolCache() { Flush(); }
+
+  PoolCache(const PoolCache&)            = delete;
+  PoolCache& operator=(const PoolCache&) = delete;
+
+  /// Takes a block, refilling from the pool in one batch when the cache is
+  /// empty. Only when the pool itself is exhausted does it fall back to
+  /// MemoryPool::Alloc with the given timeout.
+  T* Alloc(uint32_t timeout_ms = 0)
+  {
+    if (loaded_->count == 0) {
+      if (spare_->count == 0)
+        spare_->count = pool_->AllocBatch(spare_->blocks, M);
+      Swap();
+      if (loaded_->count == 0) return pool_->Alloc(timeout_ms);
+    }
+    return loaded_->blocks[--loaded_->count];
+  }
+
+  /// Caches a block from the same pool; it reaches the pool with the next
+  /// batch return or Flush(). A block from elsewhere is refused, as
+  /// MemoryPool::Free refuses it.
+  OsStatus Free(T* block)
+  {
+    if (!block || !pool_->Owns(block)) return OsStatus::Error;
+    if (loaded_->count == M) {
+      if (spare_->count == M) Return(*spare_);
+      Swap();
+    }
+    loaded_->blocks[loaded_->count++] = block;
+    return OsStatus::Ok;
+  }
+
+  /// Returns every cached block to the pool (call before the thread exits).
+  void Flush()
+  {
+    Return(*loaded_);
+    Return(*spare_);
+  }
+
+  /// Blocks held by this cache, i.e. missing from the pool's GetFreeCount().
+  uint32_t GetCachedCount() const { return loaded_->count + spare_->count; }
+
+  MemoryPool<T>& GetPool() const { return *pool_; }
+
+private:
+  struct Magazine
+  {
+    T*       blocks[M];
+    uint32_t count = 0;
+  };
+
+  void Swap()
+  {
+    Magazine* m = loaded_;
+    loaded_ = spare_;
+    spare_  = m;
+  }
+
+  void Return(Magazine& m)
+  {
+    if (m.count) pool_->FreeBatch(m.blocks, m.count);
+    m.count = 0;
+  }
+
+private:
+  MemoryPool<T>* pool_;
+  Magazine       mags_[2];
+  Magazine*      loaded_ = &mags_[0];
+  Magazine*      spare_  = &mags_[1];
+};
+
+} // namespace ifce::os
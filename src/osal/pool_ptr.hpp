@@ -0,0 +1,222 @@
+#pragma once
+
+#include "osal/types.hpp"
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ifce::os {
+
+template <typename T> class MemoryPool;
+
+namespace detail {
+
+template <typename T>
+struct PoolBackRef
+{
+  MemoryPool<T>* pool_ = nullptr;
+};
+
+struct NoPoolBackRef {};
+
+/// Returns a freshly allocated block to its pool unless Release()d, so a
+/// constructor that throws while filling the block does not leak it.
+template <typename Pool, typename Block>
+class BlockGuard
+{
+public:
+  BlockGuard(Pool* pool, Block* block) : pool_(pool), block_(block) {}
+  ~BlockGuard() { if (block_) pool_->Free(block_); }
+
+  BlockGuard(const BlockGuard&)            = delete;
+  BlockGuard& operator=(const BlockGuard&) = delete;
+
+  void Release() { block_ = nullptr; }
+
+private:
+  Pool*  pool_;
+  Block* block_;
+};
+
+} // namespace detail
+
+/// Owning handle to a T constructed in a MemoryPool block. Move-only; on
+/// destruction or Reset() it runs ~T and returns the block to its pool.
+///
+/// `PoolPtr<T>` carries the pool pointer beside the object pointer. Naming a
+/// pool with static storage duration, `PoolPtr<T, &g_pool>`, binds it at
+/// compile time instead and the handle is exactly one pointer wide.
+template <typename T, MemoryPool<T>* Pool = nullptr>
+class PoolPtr
+  : private std::conditional_t<Pool == nullptr, detail::PoolBackRef<T>, detail::NoPoolBackRef>
+{
+  using Ref = std::conditional_t<Pool == nullptr, detail::PoolBackRef<T>, detail::NoPoolBackRef>;
+
+public:
+  static constexpr bool kStaticPool = Pool != nullptr;
+
+  PoolPtr()  = default;
+  ~PoolPtr() { Reset(); }
+
+  PoolPtr(PoolPtr&& other) noexcept : Ref(other), ptr_(other.ptr_) { other.ptr_ = nullptr; }
+
+  PoolPtr& operator=(PoolPtr&& other) noexcept
+  {
+    if (this != &other) {
+      Reset();
+      Ref::operator=(other);
+      ptr_       = other.ptr_;
+      other.ptr_ = nullptr;
+    }
+    return *this;
+  }
+
+  PoolPtr(const PoolPtr&)            = delete;
+  PoolPtr& operator=(const PoolPtr&) = delete;
+
+  /// Allocates a block from `pool` without waiting and constructs a T in
+  /// it; empty if the pool is exhausted. MemoryPool::Make() is shorthand.
+  template <bool S = kStaticPool, typename... Args>
+  static std::enable_if_t<!S, PoolPtr> Make(MemoryPool<T>& pool, Args&&... args)
+  {
+    return Construct(&pool, std::forward<Args>(args)...);
+  }
+
+  /// Same, from the pool bound at compile time.
+  template <bool S = kStaticPool, typename... Args>
+  static std::enable_if_t<S, PoolPtr> Make(Args&&... args)
+  {
+    return Construct(Pool, std::forward<Args>(args)...);
+  }
+
+  T& operator*()  const { return *ptr_; }
+  T* operator->() const { return ptr_; }
+  T* Get()        const { return ptr_; }
+  explicit operator bool() const { return ptr_ != nullptr; }
+
+  MemoryPool<T>* GetPool() const
+  {
+    if constexpr (kStaticPool) return Pool;
+    else                       return this->pool_;
+  }
+
+  void Reset()
+  {
+    if (!ptr_) return;
+    T* obj = ptr_;
+    ptr_ = nullptr;
+    obj->~T();
+    GetPool()->Free(obj);
+  }
+
+private:
+  template <typename... Args>
+  static PoolPtr Construct(MemoryPool<T>* pool, Args&&... args)
+  {
+    PoolPtr p;
+    T* raw = pool->Alloc(0);
+    if (!raw) return p;
+    detail::BlockGuard<MemoryPool<T>, T> guard(pool, raw);
+    p.ptr_ = new (raw) T(std::forward<Args>(args)...);
+    guard.Release();
+    if constexpr (!kStaticPool) p.pool_ = pool;
+    return p;
+  }
+
+  T* ptr_ = nullptr;
+};
+
+/// Block layout for pools that back PoolSharedPtr<T>: the reference count
+/// and owning pool sit in front of the object, so handles stay one pointer
+/// wide and sharing needs no heap-allocated control block.
+template <typename T>
+struct PoolSharedBlock
+{
+  template <typename... Args>
+  explicit PoolSharedBlock(MemoryPool<PoolSharedBlock>* p, Args&&... args)
+    : refs(1), pool(p), value(std::forward<Args>(args)...) {}
+
+  std::atomic<uint32_t>         refs;
+  MemoryPool<PoolSharedBlock>*  pool;
+  T                             value;
+};
+
+/// Reference-counted handle to a T living in a MemoryPool<PoolSharedBlock<T>>
+/// block, for fanning one object out to several consumers. Copies bump the
+/// intrusive count; the last handle to go runs ~T and frees the block.
+template <typename T>
+class PoolSharedPtr
+{
+public:
+  using Block = PoolSharedBlock<T>;
+
+  PoolSharedPtr()  = default;
+  ~PoolSharedPtr() { Reset(); }
+
+  PoolSharedPtr(const PoolSharedPtr& other) noexcept : block_(other.block_)
+  {
+    if (block_) block_->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  PoolSharedPtr(PoolSharedPtr&& other) noexcept : block_(other.block_) { other.block_ = nullptr; }
+
+  PoolSharedPtr& operator=(const PoolSharedPtr& other) noexcept
+  {
+    if (block_ != other.block_) {
+      if (other.block_) other.block_->refs.fetch_add(1, std::memory_order_relaxed);
+      Reset();
+      block_ = other.block_;
+    }
+    return *this;
+  }
+
+  PoolSharedPtr& operator=(PoolSharedPtr&& other) noexcept
+  {
+    if (this != &other) {
+      Reset();
+      block_       = other.block_;
+      other.block_ = nullptr;
+    }
+    return *this;
+  }
+
+  /// Allocates a block from `pool` without waiting and constructs a T in
+  /// it; empty if the pool is exhausted.
+  template <typename... Args>
+  static PoolSharedPtr Make(MemoryPool<Block>& pool, Args&&... args)
+  {
+    PoolSharedPtr p;
+    Block* raw = pool.Alloc(0);
+    if (!raw) return p;
+    detail::BlockGuard<MemoryPool<Block>, Block> guard(&pool, raw);
+    p.block_ = new (raw) Block(&pool, std::forward<Args>(args)...);
+    guard.Release();
+    return p;
+  }
+
+  T& operator*()  const { return block_->value; }
+  T* operator->() const { return &block_->value; }
+  T* Get()        const { return block_ ? &block_->value : nullptr; }
+  explicit operator bool() const { return block_ != nullptr; }
+
+  /// Relaxed snapshot of the number of handles sharing the object.
+  uint32_t UseCount() const { return block_ ? block_->refs.load(std::memory_order_relaxed) : 0; }
+
+  void Reset()
+  {
+    if (!block_) return;
+    Block* b = block_;
+    block_ = nullptr;
+    if (b->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+    MemoryPool<Block>* pool = b->pool;
+    b->~Block();
+    pool->Free(b);
+  }
+
+private:
+  Block* block_ = nullptr;
+};
+
+} // namespace ifce::os
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "osal/types.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+
+namespace ifce::os::detail {
+
+/// Monotonic microsecond clock for hosted backends.
+struct SteadyMicros
+{
+  static int64_t Now()
+  {
+    auto since_epoch = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::microseconds>(since_epoch).count();
+  }
+};
+
+#if OSAL_QUEUE_STATS
+
+/// Relaxed-atomic counters behind MessageQueue::GetStats(). `Clock::Now()`
+/// returns monotonic microseconds; negative spans (tick wrap) are ignored.
+/// Counters are 64-bit where that is lock-free and 32-bit otherwise, so
+/// recording stays interrupt-safe on small cores.
+template <typename Clock>
+class QueueStatsRecorder
+{
+public:
+  static constexpr bool kEnabled = true;
+
+  /// Enqueue time carried by each queued message.
+  struct Stamp
+  {
+    int64_t us = 0;
+  };
+
+  int64_t Now() const { return Clock::Now(); }
+
+  void Put(uint32_t depth, uint32_t n = 1)
+  {
+    Add(puts_, n);
+    uint32_t seen = high_water_.load(std::memory_order_relaxed);
+    while (depth > seen &&
+           !high_water_.compare_exchange_weak(seen, depth, std::memory_order_relaxed)) {}
+  }
+
+  void Get(uint32_t n = 1)  { Add(gets_, n); }
+  void PutTimeout()         { Add(put_timeouts_, 1); }
+  void GetTimeout()         { Add(get_timeouts_, 1); }
+
+  void MarkPut(Stamp& stamp) const { stamp.us = Now(); }
+
+  /// Counts one Get and files its Put-to-Get latency.
+  void Delivered(const Stamp& stamp)
+  {
+    Get();
+    int64_t us = Now() - stamp.us;
+    uint32_t bucket = 0;
+    for (; bucket + 1 < QueueStats::kLatencyBuckets && us >= (int64_t(2) << bucket); ++bucket) {}
+    Add(latency_[bucket], 1);
+  }
+
+  /// Time one caller spent waiting on a full (producer) or empty (consumer) queue.
+  void Blocked(bool on_full, int64_t us)
+  {
+    if (us <= 0) return;
+    if (on_full) Accumulate(full_wait_, full_wait_max_, us);
+    else         Accumulate(empty_wait_, empty_wait_max_, us);
+  }
+
+  QueueStats Snapshot() const
+  {
+    QueueStats s;
+    s.high_water        = high_water_.load(std::memory_order_relaxed);
+    s.puts              = puts_.load(std::memory_order_relaxed);
+    s.gets              = gets_.load(std::memory_order_relaxed);
+    s.put_timeouts      = put_timeouts_.load(std::memory_order_relaxed);
+    s.get_timeouts      = get_timeouts_.load(std::memory_order_relaxed);
+    s.full_wait_us      = full_wait_.load(std::memory_order_relaxed);
+    s.full_wait_max_us  = full_wait_max_.load(std::memory_order_relaxed);
+    s.empty_wait_us     = empty_wait_.load(std::memory_order_relaxed);
+    s.empty_wait_max_us = empty_wait_max_.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < QueueStats::kLatencyBuckets; ++i)
+      s.latency_log2[i] = latency_[i].load(std::memory_order_relaxed);
+    return s;
+  }
+
+private:
+  using Count = std::conditional_t<std::atomic<uint64_t>::is_always_lock_free, uint64_t, uint32_t>;
+
+  static void Add(std::atomic<Count>& counter, uint32_t n)
+  {
+    counter.fetch_add(n, std::memory_order_relaxed);
+  }
+
+  static void Accumulate(std::atomic<Count>& total, std::atomic<Count>& max, int64_t us)
+  {
+    Count v = static_cast<Count>(us);
+    total.fetch_add(v, std::memory_order_relaxed);
+    Count seen = max.load(std::memory_order_relaxed);
+    while (v > seen && !max.compare_exchange_weak(seen, v, std::memory_order_relaxed)) {}
+  }
+
+  std::atomic<uint32_t> high_water_     {0};
+  std::atomic<Count>    puts_           {0};
+  std::atomic<Count>    gets_           {0};
+  std::atomic<Count>    put_timeouts_   {0};
+  std::atomic<Count>    get_timeouts_   {0};
+  std::atomic<Count>    full_wait_      {0};
+  std::atomic<Count>    full_wait_max_  {0};
+  std::atomic<Count>    empty_wait_     {0};
+  std::atomic<Count>    empty_wait_max_ {0};
+  std::atomic<Count>    latency_[QueueStats::kLatencyBuckets] = {};
+};
+
+#else
+
+/// Compiled-out recorder: every hook is an empty inline call and Now()
+/// never reads the clock, so instrumented code costs nothing.
+template <typename Clock>
+class QueueStatsRecorder
+{
+public:
+  static constexpr bool kEnabled = false;
+
+  struct Stamp {};
+
+  int64_t Now() const { return 0; }
+
+  void Put(uint32_t, uint32_t = 1) {}
+  void Get(uint32_t = 1) {}
+  void PutTimeout() {}
+  void GetTimeout() {}
+  void MarkPut(Stamp&) const {}
+  void Delivered(const Stamp&) {}
+  void Blocked(bool, int64_t) {}
+
+  QueueStats Snapshot() const { return QueueStats{}; }
+};
+
+#endif
+
+} // namespace ifce::os::detail
@@ -0,0 +1,7 @@
+#pragma once
+
+#if defined(CONFIG_INTERFACE_EMBEDDED_OSAL_POSIX) || defined(OSAL_BACKEND_POSIX)
+  #include "osal/derived/posix/shm_message_queue.hpp"
+#else
+  #error "ShmMessageQueue requires the POSIX backend"
+#endif
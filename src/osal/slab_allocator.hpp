@@ -0,0 +1,322 @@
+#pragma once
+
+#include "osal/types.hpp"
+#include "osal/free_list.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#if __has_include(<memory_resource>)
+  #include <memory_resource>
+#endif
+
+namespace ifce::os {
+
+/// One size class of a SlabAllocator.
+struct SlabClass
+{
+  uint32_t block_size;
+  uint32_t block_count;
+};
+
+/// Per-size-class counters from SlabAllocator::GetStats().
+struct SlabClassStats
+{
+  uint32_t block_size  = 0;  ///< Rounded up to alignof(std::max_align_t)
+  uint32_t block_count = 0;
+  uint32_t in_use      = 0;  ///< Blocks handed out right now
+  uint32_t high_water  = 0;  ///< Most blocks ever in use at once
+  uint32_t spilled     = 0;  ///< Allocations served here because smaller classes were full
+  uint32_t failures    = 0;  ///< Requests that fit this class but found it and all larger ones full
+  size_t   requested   = 0;  ///< Bytes callers asked for in the blocks in use
+
+  /// Percentage of the class's blocks in use.
+  uint32_t Utilization() const { return block_count ? in_use * 100u / block_count : 0; }
+
+  /// Internal fragmentation: bytes of in-use blocks that callers did not ask for.
+  size_t Wasted() const
+  {
+    size_t held = size_t(in_use) * block_size;
+    return held > requested ? held - requested : 0;
+  }
+};
+
+/// Fixed-block allocator for mixed object sizes, carving one backing region
+/// into up to kMaxClasses size classes (e.g. 16 B to 4 KB).
+///
+/// Each class is a MemoryPool-style array of equal blocks with a lock-free
+/// free list, so Allocate/Deallocate never block and are safe from any
+/// thread. A request goes to the smallest class whose block fits its size
+/// and alignment; if that class is exhausted it spills to the next larger
+/// one. Deallocate needs only the address: it finds the class from where
+/// the block lies, and each block records the size it was requested with
+/// for the fragmentation statistics. The same record marks free blocks, so
+/// a double free is refused rather than corrupting the free list.
+///
+/// AsAllocator() plugs the slab into primitives that take an Allocator
+/// (e.g. MessageQueue storage); SlabResource adapts it to
+/// std::pmr::memory_resource for STL containers.
+class SlabAllocator
+{
+public:
+  static constexpr uint32_t kMaxClasses = 16;
+  static constexpr size_t   kGranule    = alignof(std::max_align_t);
+  static constexpr size_t   kMaxAlign   = CacheLineSize;
+
+  SlabAllocator()  = default;
+  ~SlabAllocator() { Delete(); }
+
+  SlabAllocator(const SlabAllocator&)            = delete;
+  SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+  /// `classes` must be sorted by strictly increasing block size. The whole
+  /// region, including the free-list links and per-block sizes, comes from
+  /// `backing` in one allocation.
+  OsStatus Create(const SlabClass* classes, uint32_t count, const Allocator& backing = {})
+  {
+    if (region_) return OsStatus::Busy;
+    if (!classes || count == 0 || count > kMaxClasses) return OsStatus::Error;
+
+    size_t offset = 0;
+    size_t links  = 0;
+    size_t sizes  = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+      size_t bs = RoundUp(classes[i].block_size, kGranule);
+      if (classes[i].block_size == 0 || bs > UINT32_MAX ||
+          classes[i].block_count > detail::IndexFreeList::kMaxCount ||
+          (i > 0 && classes[i].block_size <= classes[i - 1].block_size))
+        return OsStatus::Error;
+      offset  = RoundUp(offset, kMaxAlign);
+      offset += bs * classes[i].block_count;
+      links  += detail::IndexFreeList::StorageSize(classes[i].block_count);
+      sizes  += sizeof(std::atomic<uint32_t>) * classes[i].block_count;
+    }
+    size_t links_at = RoundUp(offset, alignof(std::atomic<uint32_t>));
+    size_t sizes_at = RoundUp(links_at + links, alignof(std::atomic<uint32_t>));
+    region_size_ = sizes_at + sizes;
+
+    region_ = static_cast<uint8_t*>(backing.Allocate(region_size_ ? region_size_ : 1, kMaxAlign));
+    if (!region_) return OsStatus::NoMemory;
+    backing_ = backing;
+
+    offset = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+      Class& c = classes_[i];
+      offset        = RoundUp(offset, kMaxAlign);
+      c.base        = region_ + offset;
+      c.block_size  = static_cast<uint32_t>(RoundUp(classes[i].block_size, kGranule));
+      c.block_count = classes[i].block_count;
+      c.list.Init(c.block_count, region_ + links_at);
+      c.sizes       = reinterpret_cast<std::atomic<uint32_t>*>(region_ + sizes_at);
+      for (uint32_t b = 0; b < c.block_count; ++b)
+        new (&c.sizes[b]) std::atomic<uint32_t>(kFreeBlock);
+      offset   += size_t(c.block_size) * c.block_count;
+      links_at += detail::IndexFreeList::StorageSize(c.block_count);
+      sizes_at += sizeof(std::atomic<uint32_t>) * c.block_count;
+    }
+    class_count_ = count;
+    return OsStatus::Ok;
+  }
+
+  /// Every block must have been returned first.
+  OsStatus Delete()
+  {
+    if (!region_) return OsStatus::Ok;
+    for (uint32_t i = 0; i < class_count_; ++i) classes_[i].Clear();
+    backing_.Deallocate(region_, region_size_, kMaxAlign);
+    region_      = nullptr;
+    region_size_ = 0;
+    class_count_ = 0;
+    return OsStatus::Ok;
+  }
+
+  /// Returns nullptr if no class fits, or every fitting class is full.
+  void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+  {
+    uint32_t first = ClassFor(size, alignment);
+    if (first == class_count_) return nullptr;
+    for (uint32_t i = first; i < class_count_; ++i) {
+      Class& c = classes_[i];
+      if (c.block_size % alignment != 0) continue;
+      uint32_t idx = c.list.Pop();
+      if (idx == detail::IndexFreeList::kNil) continue;
+      c.sizes[idx].store(static_cast<uint32_t>(size), std::memory_order_relaxed);
+      c.Taken(size, i != first);
+      return c.base + size_t(idx) * c.block_size;
+    }
+    classes_[first].failures.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  /// Error for a pointer that is not the start of one of the slab's
+  /// blocks, or for a block that is already free.
+  OsStatus Deallocate(void* ptr)
+  {
+    uint32_t i = ClassOf(ptr);
+    if (i == class_count_) return OsStatus::Error;
+    Class& c = classes_[i];
+    size_t offset = static_cast<size_t>(static_cast<uint8_t*>(ptr) - c.base);
+    if (offset % c.block_size != 0) return OsStatus::Error;
+    uint32_t idx  = static_cast<uint32_t>(offset / c.block_size);
+    uint32_t size = c.sizes[idx].exchange(kFreeBlock, std::memory_order_relaxed);
+    if (size == kFreeBlock) return OsStatus::Error;
+    c.requested.fetch_sub(size, std::memory_order_relaxed);
+    c.list.Push(idx);
+    return OsStatus::Ok;
+  }
+
+  /// True if `ptr` lies inside one of the size classes (not the padding
+  /// between them).
+  bool Owns(const void* ptr) const { return ClassOf(ptr) != class_count_; }
+
+  uint32_t GetClassCount() const { return class_count_; }
+
+  SlabClassStats GetStats(uint32_t class_index) const
+  {
+    SlabClassStats s;
+    if (class_index >= class_count_) return s;
+    const Class& c = classes_[class_index];
+    uint32_t free = c.list.Size();
+    s.block_size  = c.block_size;
+    s.block_count = c.block_count;
+    s.in_use      = free < c.block_count ? c.block_count - free : 0;
+    s.high_water  = c.high_water.load(std::memory_order_relaxed);
+    s.spilled     = c.spilled.load(std::memory_order_relaxed);
+    s.failures    = c.failures.load(std::memory_order_relaxed);
+    s.requested   = c.requested.load(std::memory_order_relaxed);
+    return s;
+  }
+
+  /// Allocator hook routing a primitive's Create-time storage to this slab.
+  Allocator AsAllocator()
+  {
+    Allocator a;
+    a.allocate   = [](size_t size, size_t alignment, void* ctx) -> void* {
+      return static_cast<SlabAllocator*>(ctx)->Allocate(size, alignment);
+    };
+    a.deallocate = [](void* ptr, size_t, size_t, void* ctx) {
+      static_cast<SlabAllocator*>(ctx)->Deallocate(ptr);
+    };
+    a.ctx        = this;
+    return a;
+  }
+
+private:
+  struct Class
+  {
+    uint8_t* End() const { return base + size_t(block_size) * block_count; }
+
+    void Taken(size_t size, bool spill)
+    {
+      requested.fetch_add(size, std::memory_order_relaxed);
+      if (spill) spilled.fetch_add(1, std::memory_order_relaxed);
+      uint32_t free = list.Size();
+      uint32_t used = free < block_count ? block_count - free : 0;
+      uint32_t seen = high_water.load(std::memory_order_relaxed);
+      while (used > seen &&
+             !high_water.compare_exchange_weak(seen, used, std::memory_order_relaxed)) {}
+    }
+
+    void Clear()
+    {
+      list.Destroy();
+      base        = nullptr;
+      sizes       = nullptr;
+      block_size  = 0;
+      block_count = 0;
+      high_water.store(0, std::memory_order_relaxed);
+      spilled.store(0, std::memory_order_relaxed);
+      failures.store(0, std::memory_order_relaxed);
+      requested.store(0, std::memory_order_relaxed);
+    }
+
+    uint8_t*               base        = nullptr;
+    std::atomic<uint32_t>* sizes       = nullptr;  // requested size per block; kFreeBlock if free
+    uint32_t               block_size  = 0;
+    uint32_t               block_count = 0;
+    detail::IndexFreeList  list;
+    std::atomic<uint32_t>  high_water  {0};
+    std::atomic<uint32_t>  spilled     {0};
+    std::atomic<uint32_t>  failures    {0};
+    std::atomic<size_t>    requested   {0};
+  };
+
+  // Never a requested size: block sizes are rounded to kGranule
+  static constexpr uint32_t kFreeBlock = UINT32_MAX;
+
+  static constexpr size_t RoundUp(size_t v, size_t to) { return (v + to - 1) / to * to; }
+
+  /// Smallest class that could hold the request, or class_count_.
+  uint32_t ClassFor(size_t size, size_t alignment) const
+  {
+    if (alignment == 0 || alignment > kMaxAlign || (alignment & (alignment - 1)) != 0)
+      return class_count_;
+    uint32_t i = 0;
+    while (i < class_count_ && (classes_[i].block_size < size || classes_[i].block_size % alignment != 0))
+      ++i;
+    return i;
+  }
+
+  /// Class whose blocks contain `ptr`, or class_count_.
+  uint32_t ClassOf(const void* ptr) const
+  {
+    auto* p = static_cast<const uint8_t*>(ptr);
+    uint32_t i = 0;
+    while (i < class_count_ && (p < classes_[i].base || p >= classes_[i].End()))
+      ++i;
+    return i;
+  }
+
+private:
+  Class     classes_[kMaxClasses];
+  uint32_t  class_count_ = 0;
+  uint8_t*  region_      = nullptr;
+  size_t    region_size_ = 0;
+  Allocator backing_;
+};
+
+#if __has_include(<memory_resource>)
+
+/// std::pmr::memory_resource view of a SlabAllocator. Requests the slab
+/// cannot serve go to `upstream`; the default null_memory_resource makes
+/// them throw std::bad_alloc, as the pmr contract requires.
+class SlabResource : public std::pmr::memory_resource
+{
+public:
+  explicit SlabResource(SlabAllocator& slab,
+                        std::pmr::memory_resource* upstream = std::pmr::null_memory_resource())
+    : slab_(slab), upstream_(upstream) {}
+
+  SlabAllocator& GetSlab() const { return slab_; }
+
+private:
+  void* do_allocate(size_t bytes, size_t alignment) override
+  {
+    void* p = slab_.Allocate(bytes, alignment);
+    return p ? p : upstream_->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override
+  {
+    if (!slab_.Owns(p)) {
+      upstream_->deallocate(p, bytes, alignment);
+      return;
+    }
+    OsStatus rc = slab_.Deallocate(p);
+    assert(rc == OsStatus::Ok && "SlabResource: double free or misaligned pointer");
+    (void)rc;
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+  {
+    return this == &other;
+  }
+
+  SlabAllocator&             slab_;
+  std::pmr::memory_resource* upstream_;
+};
+
+#endif
+
+} // namespace ifce::os
@@ -0,0 +1,368 @@
+#pragma once
+
+#include "osal/types.hpp"
+#include "osal/lock_guard.hpp"
+#include "osal/memory_pool.hpp"
+#include "osal/message_queue.hpp"
+#include "osal/mutex.hpp"
+#include "osal/semaphore.hpp"
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ifce::os {
+
+/// Per-subscriber delivery counters
+struct SubscriberStats
+{
+  uint32_t depth;       ///< Samples queued right now
+  uint32_t high_water;  ///< Deepest the queue has been
+  uint32_t delivered;   ///< Samples handed to the subscriber queue
+  uint32_t dropped;     ///< Samples lost to the overflow policy
+};
+
+/// Publish/subscribe fan-out over pooled, reference-counted samples.
+///
+/// A sample is written once into a MemoryPool block; each subscriber queue
+/// receives only a Sample reference to it, and the block returns to the
+/// pool when the last Sample referring to it is dropped. Every subscriber
+/// has its own depth and OverflowPolicy, applied by its MessageQueue, so a
+/// slow consumer loses its own samples (or, with Block, holds up delivery
+/// only until the publish timeout) instead of stalling the publisher.
+/// Samples carry no priority, so EvictLowest is refused at Subscribe.
+///
+/// The subscriber queues hold Samples, whose destructor drops the queue's
+/// reference when the overflow policy evicts one; that needs a backend
+/// whose MessageQueue owns non-trivially-copyable messages (posix, cppstd).
+///
+/// All Samples must be released before the Topic is deleted.
+template <typename T>
+class Topic
+{
+  struct Node
+  {
+    template <typename... Args>
+    explicit Node(Args&&... args) : value(std::forward<Args>(args)...), refs(1) {}
+
+    T                     value;  // first member: Commit() maps T* back to Node*
+    std::atomic<uint32_t> refs;
+  };
+
+public:
+  /// Read-only reference to a published sample. Move-only; the reference
+  /// is dropped on destruction or Reset().
+  class Sample
+  {
+  public:
+    Sample()  = default;
+    ~Sample() { Reset(); }
+
+    Sample(Sample&& other) noexcept : topic_(other.topic_), node_(other.node_)
+    {
+      other.node_ = nullptr;
+    }
+
+    Sample& operator=(Sample&& other) noexcept
+    {
+      if (this != &other) {
+        Reset();
+        topic_      = other.topic_;
+        node_       = other.node_;
+        other.node_ = nullptr;
+      }
+      return *this;
+    }
+
+    Sample(const Sample&)            = delete;
+    Sample& operator=(const Sample&) = delete;
+
+    const T& operator*()  const { return node_->value; }
+    const T* operator->() const { return &node_->value; }
+    const T* Get()        const { return node_ ? &node_->value : nullptr; }
+    explicit operator bool() const { return node_ != nullptr; }
+
+    void Reset()
+    {
+      if (!node_) return;
+      topic_->Unref(node_);
+      node_ = nullptr;
+    }
+
+  private:
+    friend class Topic;
+    Sample(Topic* topic, Node* node) : topic_(topic), node_(node) {}
+
+    Topic* topic_ = nullptr;
+    Node*  node_  = nullptr;
+  };
+
+  /// One consumer's queue of sample references.
+  class Subscriber
+  {
+  public:
+    Subscriber()  = default;
+    ~Subscriber() { if (topic_) topic_->Unsubscribe(*this); }
+
+    Subscriber(const Subscriber&)            = delete;
+    Subscriber& operator=(const Subscriber&) = delete;
+
+    /// Next sample, in publish order.
+    OsStatus Take(Sample& out, uint32_t timeout_ms = WaitForever)
+    {
+      if (!topic_) return OsStatus::Error;
+      return queue_.Get(out, timeout_ms);
+    }
+
+    SubscriberStats GetStats() const
+    {
+      DropStats drops = queue_.GetDropStats();
+      return { queue_.GetCount(),
+               high_water_.load(std::memory_order_relaxed),
+               delivered_.load(std::memory_order_relaxed),
+               drops.rejected + drops.evicted + timed_out_.load(std::memory_order_relaxed) };
+    }
+
+  private:
+    friend class Topic;
+
+    MessageQueue<Sample>  queue_;
+    Topic*                topic_      = nullptr;
+    Subscriber*           next_       = nullptr;
+    uint32_t              pins_       = 0;      // publishers delivering here; under mutex_
+    bool                  leaving_    = false;  // Unsubscribe in progress; under mutex_
+    Semaphore             unpinned_;            // a publisher let go while leaving_
+    OverflowPolicy        policy_     = OverflowPolicy::DropNewest;
+    std::atomic<uint32_t> high_water_ {0};
+    std::atomic<uint32_t> delivered_  {0};
+    std::atomic<uint32_t> timed_out_  {0};      // Block-policy puts; lossy drops are in queue_
+
+  };
+
+  Topic()  = default;
+  ~Topic() { Delete(); }
+
+  Topic(const Topic&)            = delete;
+  Topic& operator=(const Topic&) = delete;
+
+  /// `pool_blocks` bounds the samples alive at once: queued, held by
+  /// subscribers, or being published.
+  OsStatus Create(uint32_t pool_blocks)
+  {
+    if (created_) return OsStatus::Busy;
+    OsStatus rc = mutex_.Create();
+    if (rc != OsStatus::Ok) return rc;
+    rc = pool_.Create(pool_blocks);
+    if (rc != OsStatus::Ok) {
+      mutex_.Delete();
+      return rc;
+    }
+    created_ = true;
+    return OsStatus::Ok;
+  }
+
+  /// Unsubscribes anyone still attached, then frees the pool.
+  OsStatus Delete()
+  {
+    if (!created_) return OsStatus::Ok;
+    while (subscribers_)
+      Unsubscribe(*subscribers_);
+    pool_.Delete();
+    mutex_.Delete();
+    created_ = false;
+    return OsStatus::Ok;
+  }
+
+  /// Error for OverflowPolicy::EvictLowest: every sample has the same
+  /// priority, so there is never a lower one to evict.
+  OsStatus Subscribe(Subscriber& sub, uint32_t depth,
+                     OverflowPolicy policy = OverflowPolicy::DropNewest)
+  {
+    if (!created_ || depth == 0 || policy == OverflowPolicy::EvictLowest)
+      return OsStatus::Error;
+    if (sub.topic_) return OsStatus::Busy;
+    OsStatus rc = sub.queue_.Create(depth, policy);
+    if (rc != OsStatus::Ok) return rc;
+    rc = sub.unpinned_.Create(1, 0);
+    if (rc != OsStatus::Ok) {
+      sub.queue_.Delete();
+      return rc;
+    }
+
+    sub.policy_ = policy;
+    sub.high_water_.store(0, std::memory_order_relaxed);
+    sub.delivered_.store(0, std::memory_order_relaxed);
+    sub.timed_out_.store(0, std::memory_order_relaxed);
+    sub.topic_ = this;
+
+    LockGuard<Mutex> lock(mutex_);
+    Subscriber** tail = &subscribers_;
+    while (*tail) tail = &(*tail)->next_;
+    sub.next_    = nullptr;
+    sub.pins_    = 0;
+    sub.leaving_ = false;
+    *tail        = &sub;
+    ++subscriber_count_;
+    return OsStatus::Ok;
+  }
+
+  /// Detaches `sub` and drops the samples still queued for it. A publisher
+  /// in the middle of delivering to `sub` is let finish first: each one
+  /// signals unpinned_ on its way out, and draining the queue before every
+  /// wait unblocks any still waiting on a full Block-policy queue.
+  OsStatus Unsubscribe(Subscriber& sub)
+  {
+    if (sub.topic_ != this) return OsStatus::Error;
+    for (;;) {
+      {
+        LockGuard<Mutex> lock(mutex_);
+        sub.leaving_ = true;
+        if (sub.pins_ == 0) {
+          for (Subscriber** link = &subscribers_; *link; link = &(*link)->next_) {
+            if (*link == &sub) {
+              *link = sub.next_;
+              --subscriber_count_;
+              break;
+            }
+          }
+          break;
+        }
+      }
+      Drain(sub);
+      sub.unpinned_.Acquire(WaitForever);
+    }
+
+    Drain(sub);
+    sub.queue_.Delete();
+    sub.unpinned_.Delete();
+    sub.topic_ = nullptr;
+    sub.next_  = nullptr;
+    return OsStatus::Ok;
+  }
+
+  /// Copies `value` into a pooled block and fans it out. `timeout_ms`
+  /// bounds the wait for a free block and for Block-policy subscribers.
+  OsStatus Publish(const T& value, uint32_t timeout_ms = 0)
+  {
+    Deadline deadline = Deadline::FromTimeout(timeout_ms);
+    Node*    node     = NewNode(deadline, value);
+    if (!node) return OsStatus::NoMemory;
+    FanOut(node, deadline);
+    return OsStatus::Ok;
+  }
+
+  /// Zero-copy publish: fill the returned sample in place, then Commit().
+  /// Needs a standard-layout T.
+  T* Reserve(uint32_t timeout_ms = 0)
+  {
+    Node* node = NewNode(Deadline::FromTimeout(timeout_ms));
+    return node ? &node->value : nullptr;
+  }
+
+  OsStatus Commit(T* sample, uint32_t timeout_ms = 0)
+  {
+    // `value` is only pointer-interconvertible with the Node if Node is
+    // standard-layout, which needs T to be
+    static_assert(std::is_standard_layout_v<Node>,
+                  "Topic<T>::Commit needs a standard-layout T; use Publish()");
+    if (!created_ || !sample) return OsStatus::Error;
+    FanOut(reinterpret_cast<Node*>(sample), Deadline::FromTimeout(timeout_ms));
+    return OsStatus::Ok;
+  }
+
+  uint32_t GetSubscriberCount() const { return subscriber_count_; }
+
+  /// Blocks not currently holding a sample.
+  uint32_t GetFreeCount() const { return pool_.GetFreeCount(); }
+
+private:
+  template <typename... Args>
+  Node* NewNode(const Deadline& deadline, Args&&... args)
+  {
+    if (!created_) return nullptr;
+    Node* raw = pool_.Alloc(deadline.RemainingMs());
+    if (!raw) return nullptr;
+    detail::BlockGuard<MemoryPool<Node>, Node> guard(&pool_, raw);
+    Node* node = new (raw) Node(std::forward<Args>(args)...);
+    guard.Release();
+    return node;
+  }
+
+  /// Walks the subscriber list hand over hand and delivers with mutex_
+  /// released, so a full Block-policy queue stalls only this publish, not
+  /// other publishers or (Un)Subscribe. The subscriber being served stays
+  /// pinned until the lock is retaken, which keeps it, and therefore its
+  /// next_ link, in the list. The publisher's own reference keeps the node
+  /// alive across the loop and is dropped at the end, so an unsubscribed
+  /// topic frees at once.
+  void FanOut(Node* node, const Deadline& deadline)
+  {
+    mutex_.Lock();
+    Subscriber* sub = Pin(subscribers_);
+    while (sub) {
+      bool live = !sub->leaving_;
+      mutex_.Unlock();
+
+      if (live) {
+        // The queue owns this reference; a rejected or evicted Sample
+        // drops it again on destruction
+        node->refs.fetch_add(1, std::memory_order_relaxed);
+        if (sub->queue_.Put(Sample(this, node), deadline) == OsStatus::Ok) {
+          sub->delivered_.fetch_add(1, std::memory_order_relaxed);
+          UpdateHighWater(*sub);
+        } else if (sub->policy_ == OverflowPolicy::Block) {
+          sub->timed_out_.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+
+      mutex_.Lock();
+      Subscriber* next = Pin(sub->next_);
+      Unpin(*sub);
+      sub = next;
+    }
+    mutex_.Unlock();
+    Unref(node);
+  }
+
+  /// Caller holds mutex_.
+  static Subscriber* Pin(Subscriber* sub)
+  {
+    if (sub) ++sub->pins_;
+    return sub;
+  }
+
+  /// Caller holds mutex_. Signals on every unpin, not just the last, so
+  /// Unsubscribe drains again when publishers remain blocked behind one
+  /// that has just refilled the queue.
+  static void Unpin(Subscriber& sub)
+  {
+    --sub.pins_;
+    if (sub.leaving_) sub.unpinned_.Release();
+  }
+
+  /// Drops the queued samples' references and wakes blocked publishers.
+  static void Drain(Subscriber& sub) { sub.queue_.Reset(); }
+
+  static void UpdateHighWater(Subscriber& sub)
+  {
+    uint32_t depth = sub.queue_.GetCount();
+    uint32_t seen  = sub.high_water_.load(std::memory_order_relaxed);
+    while (depth > seen
+           && !sub.high_water_.compare_exchange_weak(seen, depth, std::memory_order_relaxed)) {}
+  }
+
+  void Unref(Node* node)
+  {
+    if (node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+    node->~Node();
+    pool_.Free(node);
+  }
+
+  MemoryPool<Node> pool_;
+  Mutex            mutex_;
+  Subscriber*      subscribers_      = nullptr;
+  uint32_t         subscriber_count_ = 0;
+  bool             created_          = false;
+};
+
+} // namespace ifce::os
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <ctime>
 #include <functional>
+#include <new>
 
 namespace ifce::os {
 
@@ -29,9 +33,220 @@ enum class ThreadPriority : int
   Realtime    = 99,
 };
 
+/// What a bounded channel does with a new item while it is full
+enum class OverflowPolicy : uint8_t
+{
+  Block,        ///< Wait for space, up to the caller's timeout
+  DropNewest,   ///< Reject the new item
+  DropOldest,   ///< Evict the earliest-queued item, whatever its priority, to make room
+  EvictLowest,  ///< Evict the oldest item of a lower priority, else reject the new item
+};
+
+/// How a MemoryPool serializes Alloc/Free on its free list
+enum class PoolSync : uint8_t
+{
+  Mutex,     ///< One lock around the list
+  LockFree,  ///< Tagged-index CAS stack; never blocks or inverts priority
+};
+
 /// Infinite wait sentinel
 static constexpr uint32_t WaitForever = 0xFFFFFFFFu;
 
+/// Relative time span with microsecond resolution
+struct Duration
+{
+  int64_t us = 0;
+
+  static constexpr Duration Micros(int64_t n)  { return Duration{n}; }
+  static constexpr Duration Millis(int64_t n)  { return Duration{n * 1000}; }
+  static constexpr Duration Seconds(int64_t n) { return Duration{n * 1000000}; }
+};
+
+/// Absolute point on the monotonic clock (std::chrono::steady_clock, i.e.
+/// CLOCK_MONOTONIC on POSIX hosts), so wall-clock steps never shorten or
+/// stretch a wait. Computed once per call; retry loops reuse it.
+///
+/// Timed calls come in pairs: a legacy `uint32_t` millisecond timeout and a
+/// Deadline. Helpers templated on a `Timeout` parameter take either one and
+/// hand it to ParkingLot::Wait, which has both overloads.
+class Deadline
+{
+public:
+  static Deadline Never() { return Deadline(kNever); }
+
+  static Deadline Now()
+  {
+    auto since_epoch = std::chrono::steady_clock::now().time_since_epoch();
+    return Deadline(std::chrono::duration_cast<std::chrono::microseconds>(since_epoch).count());
+  }
+
+  static Deadline In(Duration d) { return Now() + d; }
+
+  /// Legacy millisecond timeouts: WaitForever never expires, 0 polls.
+  static Deadline FromTimeout(uint32_t timeout_ms)
+  {
+    if (timeout_ms == WaitForever) return Never();
+    if (timeout_ms == 0) return Deadline(0);
+    return In(Duration::Millis(timeout_ms));
+  }
+
+  bool IsNever() const { return us_ == kNever; }
+  bool Expired() const { return !IsNever() && Now().us_ >= us_; }
+
+  /// Time left, clamped at zero.
+  Duration Remaining() const
+  {
+    if (IsNever()) return Duration{kNever};
+    int64_t left = us_ - Now().us_;
+    return Duration{left > 0 ? left : 0};
+  }
+
+  /// Time left in milliseconds (rounded up), for APIs that only take ms.
+  uint32_t RemainingMs() const
+  {
+    if (IsNever()) return WaitForever;
+    int64_t ms = (Remaining().us + 999) / 1000;
+    return (ms >= WaitForever) ? WaitForever - 1 : static_cast<uint32_t>(ms);
+  }
+
+  Deadline operator+(Duration d) const
+  {
+    if (IsNever() || d.us >= kNever - us_) return Never();
+    return Deadline(us_ + d.us);
+  }
+
+  /// First `*this + k * period` (k >= 1) that has not passed yet, for
+  /// fixed-rate schedules that skip the slots an overrun missed.
+  Deadline NextSlot(Duration period) const
+  {
+    Deadline next = *this + period;
+    while (period.us > 0 && next.Expired()) next = next + period;
+    return next;
+  }
+
+  std::chrono::steady_clock::time_point ToTimePoint() const
+  {
+    return std::chrono::steady_clock::time_point(std::chrono::microseconds(us_));
+  }
+
+  /// Absolute CLOCK_MONOTONIC timespec for the *clock* waits.
+  struct timespec ToTimespec() const
+  {
+    struct timespec ts;
+    ts.tv_sec  = static_cast<time_t>(us_ / 1000000);
+    ts.tv_nsec = static_cast<long>(us_ % 1000000) * 1000L;
+    return ts;
+  }
+
+private:
+  static constexpr int64_t kNever = INT64_MAX;
+
+  explicit Deadline(int64_t us) : us_(us) {}
+
+  int64_t us_;
+};
+
+/// Destructive-interference size used to keep producer/consumer state apart
+static constexpr size_t CacheLineSize = 64;
+
+/// Round up to the next power of two (0 and 1 map to 1)
+constexpr uint32_t NextPowerOfTwo(uint32_t v)
+{
+  if (v <= 1) return 1;
+  --v;
+  v |= v >> 1;
+  v |= v >> 2;
+  v |= v >> 4;
+  v |= v >> 8;
+  v |= v >> 16;
+  return v + 1;
+}
+
+#ifndef OSAL_SPIN_COUNT
+  #define OSAL_SPIN_COUNT 64
+#endif
+#ifndef OSAL_SPIN_YIELDS
+  #define OSAL_SPIN_YIELDS 0
+#endif
+
+/// Busy-wait budget spent before a blocking call parks the thread.
+/// Each spin re-checks the condition after an exponentially growing run of
+/// CPU pause instructions; the yields then give up the time slice between
+/// checks. Defaults come from OSAL_SPIN_COUNT / OSAL_SPIN_YIELDS. Hosted
+/// backends skip the spins on a single-CPU machine.
+struct SpinPolicy
+{
+  uint32_t spins  = OSAL_SPIN_COUNT;
+  uint32_t yields = OSAL_SPIN_YIELDS;
+};
+
+/// How often blocking waits were satisfied while spinning vs. had to park.
+/// Waits that succeed on the first check are not counted.
+struct SpinStats
+{
+  uint32_t spin_hits = 0;
+  uint32_t parks     = 0;
+};
+
+/// Items lost to a lossy OverflowPolicy.
+struct DropStats
+{
+  uint32_t rejected = 0;  ///< New items refused
+  uint32_t evicted  = 0;  ///< Queued items discarded to make room
+};
+
+#ifndef OSAL_QUEUE_STATS
+  #if defined(CONFIG_INTERFACE_EMBEDDED_OSAL_QUEUE_STATS)
+    #define OSAL_QUEUE_STATS 1
+  #else
+    #define OSAL_QUEUE_STATS 0
+  #endif
+#endif
+
+/// MessageQueue instrumentation, collected only when built with
+/// OSAL_QUEUE_STATS=1 (otherwise every field reads zero). Times are in
+/// microseconds; RTOS backends measure them at tick resolution.
+struct QueueStats
+{
+  /// latency_log2[i] counts messages that waited [2^i, 2^(i+1)) us between
+  /// Put and Get (bucket 0 also takes 0 us, the last bucket everything above).
+  static constexpr uint32_t kLatencyBuckets = 24;
+
+  uint32_t high_water         = 0;  ///< Deepest the queue has been
+  uint64_t puts               = 0;
+  uint64_t gets               = 0;
+  uint64_t put_timeouts       = 0;  ///< Puts that gave up on a full queue
+  uint64_t get_timeouts       = 0;  ///< Gets that gave up on an empty queue
+  uint64_t full_wait_us       = 0;  ///< Total time producers waited for space
+  uint64_t full_wait_max_us   = 0;
+  uint64_t empty_wait_us      = 0;  ///< Total time consumers waited for data
+  uint64_t empty_wait_max_us  = 0;
+  uint64_t latency_log2[kLatencyBuckets] = {};
+};
+
+/// Storage hook for primitives that preallocate their buffers at Create time,
+/// e.g. to place queue rings in an application arena. A default-constructed
+/// Allocator uses the global aligned operator new.
+struct Allocator
+{
+  void* (*allocate)(size_t size, size_t alignment, void* ctx)              = nullptr;
+  void  (*deallocate)(void* ptr, size_t size, size_t alignment, void* ctx) = nullptr;
+  void*  ctx                                                               = nullptr;
+
+  void* Allocate(size_t size, size_t alignment) const
+  {
+    if (allocate) return allocate(size, alignment, ctx);
+    return ::operator new(size, std::align_val_t(alignment), std::nothrow);
+  }
+
+  void Deallocate(void* ptr, size_t size, size_t alignment) const
+  {
+    if (!ptr) return;
+    if (deallocate) deallocate(ptr, size, alignment, ctx);
+    else            ::operator delete(ptr, std::align_val_t(alignment));
+  }
+};
+
 /// Common callback signatures
 using ThreadFunc = std::function<void(void*)>;
 using TimerFunc  = std::function<void(void*)>;
@@ -0,0 +1,17 @@
+#pragma once
+
+/// @file check.hpp
+/// @brief Minimal assertion helper shared by the test/ programs.
+
+#include <cstdio>
+#include <cstdlib>
+
+/// Unlike assert(), stays active under NDEBUG.
+#define CHECK(cond)                                                     \
+  do {                                                                  \
+    if (!(cond)) {                                                      \
+      std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__,       \
+                   __LINE__, #cond);                                    \
+      std::exit(1);                                                     \
+    }                                                                   \
+  } while (0)
@@ -0,0 +1,139 @@
+/// @file test_message_queue.cpp
+/// @brief A payload whose copy or assignment throws must leave the queue
+/// unlocked and its slots accounted for; DropOldest must evict the
+/// earliest-queued message even after PutToFront reordered a level.
+
+#include "check.hpp"
+#include "osal/osal.hpp"
+#include <initializer_list>
+#include <stdexcept>
+
+using namespace ifce::os;
+
+namespace {
+
+bool g_throw_assign = false;
+
+/// Copying a negative value throws; so does assigning while g_throw_assign.
+struct Payload
+{
+  int value = 0;
+
+  Payload() = default;
+  explicit Payload(int v) : value(v) {}
+
+  Payload(const Payload& other) : value(other.value)
+  {
+    if (value < 0) throw std::runtime_error("copy");
+  }
+
+  Payload& operator=(const Payload& other)
+  {
+    if (g_throw_assign) throw std::runtime_error("assign");
+    value = other.value;
+    return *this;
+  }
+};
+
+template <typename Fn>
+bool Throws(Fn&& fn)
+{
+  try {
+    fn();
+  } catch (const std::runtime_error&) {
+    return true;
+  }
+  return false;
+}
+
+void ThrowingPutKeepsQueueUsable()
+{
+  MessageQueue<Payload> queue;
+  CHECK(queue.Create(2) == OsStatus::Ok);
+
+  Payload bad(-1);
+  CHECK(Throws([&] { queue.Put(bad, 0); }));
+  CHECK(Throws([&] { queue.PutToFront(bad, 0); }));
+
+  // Neither the lock nor a slot was lost: both slots still take messages
+  CHECK(queue.Put(Payload(1), 100) == OsStatus::Ok);
+  CHECK(queue.Put(Payload(2), 100) == OsStatus::Ok);
+  CHECK(queue.GetCount() == 2);
+
+  Payload out;
+  CHECK(queue.Get(out, 0) == OsStatus::Ok && out.value == 1);
+  CHECK(queue.Get(out, 0) == OsStatus::Ok && out.value == 2);
+}
+
+void ThrowingGetKeepsMessage()
+{
+  MessageQueue<Payload> queue;
+  CHECK(queue.Create(2) == OsStatus::Ok);
+  CHECK(queue.Put(Payload(7), 0) == OsStatus::Ok);
+
+  Payload out;
+  g_throw_assign = true;
+  CHECK(Throws([&] { queue.Get(out, 0); }));
+  g_throw_assign = false;
+
+  CHECK(queue.GetCount() == 1);
+  CHECK(queue.Get(out, 100) == OsStatus::Ok && out.value == 7);
+}
+
+void ThrowingPutManyPublishesPrefix()
+{
+  MessageQueue<Payload> queue;
+  CHECK(queue.Create(4) == OsStatus::Ok);
+
+  Payload batch[3] = {Payload(1), Payload(2), Payload(-1)};
+  CHECK(Throws([&] { queue.PutMany(batch, 3, 0); }));
+
+  // The two copied before the throw are queued; the rest of the pool is free
+  CHECK(queue.GetCount() == 2);
+  CHECK(queue.Put(Payload(4), 0) == OsStatus::Ok);
+  CHECK(queue.Put(Payload(5), 0) == OsStatus::Ok);
+  CHECK(queue.GetCount() == 4);
+}
+
+void ExpectOrder(MessageQueue<int>& queue, std::initializer_list<int> expected)
+{
+  for (int want : expected) {
+    int got = -1;
+    CHECK(queue.Get(got, 0) == OsStatus::Ok && got == want);
+  }
+  CHECK(queue.GetCount() == 0);
+}
+
+void DropOldestAcrossPutToFront()
+{
+  MessageQueue<int> queue;
+  CHECK(queue.Create(3, OverflowPolicy::DropOldest) == OsStatus::Ok);
+
+  // 1 is oldest but sits behind 3 on the top level; 2 heads level 0
+  CHECK(queue.Put(1, 7, 0) == OsStatus::Ok);
+  CHECK(queue.Put(2, 0, 0) == OsStatus::Ok);
+  CHECK(queue.PutToFront(3, 0) == OsStatus::Ok);
+  CHECK(queue.Put(4, 0, 0) == OsStatus::Ok);
+  ExpectOrder(queue, {3, 2, 4});
+
+  // The oldest is now in the middle of the PutToFront run
+  CHECK(queue.Delete() == OsStatus::Ok);
+  CHECK(queue.Create(4, OverflowPolicy::DropOldest) == OsStatus::Ok);
+  CHECK(queue.PutToFront(10, 0) == OsStatus::Ok);
+  CHECK(queue.Put(11, 7, 0) == OsStatus::Ok);
+  CHECK(queue.PutToFront(12, 0) == OsStatus::Ok);
+  CHECK(queue.Put(13, 0, 0) == OsStatus::Ok);
+  CHECK(queue.Put(14, 0, 0) == OsStatus::Ok);
+  ExpectOrder(queue, {12, 11, 13, 14});
+}
+
+} // namespace
+
+int main()
+{
+  ThrowingPutKeepsQueueUsable();
+  ThrowingGetKeepsMessage();
+  ThrowingPutManyPublishesPrefix();
+  DropOldestAcrossPutToFront();
+  return 0;
+}
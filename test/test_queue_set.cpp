@@ -0,0 +1,89 @@
+/// @file test_queue_set.cpp
+/// @brief A QueueSet deleted before its members must unbind them, and a
+/// member deleted before its set must leave it, so neither side is ever
+/// touched after it is gone.
+
+#include "check.hpp"
+#include "osal/osal.hpp"
+#include <memory>
+
+using namespace ifce::os;
+
+/// Set deleted first: every member path that used to post to, retract
+/// from or leave the set must now run against no set at all.
+static void SetDeletedBeforeMembers()
+{
+  MessageQueue<int> queue;
+  MessageQueue<int> lossy;
+  Semaphore         sem;
+  CHECK(queue.Create(4) == OsStatus::Ok);
+  CHECK(lossy.Create(1, OverflowPolicy::DropOldest) == OsStatus::Ok);
+  CHECK(sem.Create(4, 0) == OsStatus::Ok);
+
+  auto set = std::make_unique<QueueSet>();
+  CHECK(set->Create(16) == OsStatus::Ok);
+  CHECK(set->Add(queue) == OsStatus::Ok);
+  CHECK(set->Add(lossy) == OsStatus::Ok);
+  CHECK(set->Add(sem) == OsStatus::Ok);
+  CHECK(queue.Put(1, 0) == OsStatus::Ok);
+  CHECK(set->Select(0) == &queue);
+  set.reset();
+
+  // Put, Commit, evict, Release and Reset all used to reach the dead set
+  CHECK(queue.Put(2, 0) == OsStatus::Ok);
+  int* slot = queue.Reserve(0);
+  CHECK(slot != nullptr);
+  *slot = 3;
+  CHECK(queue.Commit(slot) == OsStatus::Ok);
+  CHECK(lossy.Put(1, 0) == OsStatus::Ok);
+  CHECK(lossy.Put(2, 0) == OsStatus::Ok);
+  CHECK(lossy.GetDropStats().evicted == 1);
+  CHECK(sem.Release() == OsStatus::Ok);
+  CHECK(lossy.Reset() == OsStatus::Ok);
+
+  int v = 0;
+  CHECK(queue.Get(v, 0) == OsStatus::Ok && v == 1);
+  CHECK(queue.Get(v, 0) == OsStatus::Ok && v == 2);
+  CHECK(queue.Get(v, 0) == OsStatus::Ok && v == 3);
+  CHECK(sem.Acquire(0) == OsStatus::Ok);
+
+  // Unbound members may join a new set
+  QueueSet next;
+  CHECK(next.Create(8) == OsStatus::Ok);
+  CHECK(next.Add(queue) == OsStatus::Ok);
+  CHECK(next.Add(sem) == OsStatus::Ok);
+  CHECK(sem.Release() == OsStatus::Ok);
+  CHECK(next.Select(0) == &sem);
+
+  CHECK(queue.Delete() == OsStatus::Ok);
+  CHECK(sem.Delete() == OsStatus::Ok);
+  CHECK(next.Select(0) == nullptr);
+}
+
+/// Members deleted first, with items and events still pending: the set
+/// must forget them, or its own Delete would unbind freed members.
+static void MembersDeletedBeforeSet()
+{
+  QueueSet set;
+  CHECK(set.Create(8) == OsStatus::Ok);
+  {
+    auto queue = std::make_unique<MessageQueue<int>>();
+    auto sem   = std::make_unique<Semaphore>();
+    CHECK(queue->Create(4) == OsStatus::Ok);
+    CHECK(sem->Create(4, 0) == OsStatus::Ok);
+    CHECK(set.Add(*queue) == OsStatus::Ok);
+    CHECK(set.Add(*sem) == OsStatus::Ok);
+    CHECK(queue->Put(1, 0) == OsStatus::Ok);
+    CHECK(sem->Release() == OsStatus::Ok);
+  }
+  CHECK(set.Select(0) == nullptr);
+  CHECK(set.Delete() == OsStatus::Ok);
+}
+
+int main()
+{
+  SetDeletedBeforeMembers();
+  MembersDeletedBeforeSet();
+  std::puts("test_queue_set: ok");
+  return 0;
+}
@@ -0,0 +1,54 @@
+/// @file test_timer.cpp
+/// @brief An auto-reload timer whose callback overruns skips the missed
+/// periods and stays on its original schedule.
+
+#include "check.hpp"
+#include "osal/osal.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace ifce::os;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr int kPeriodMs  = 50;
+constexpr int kOverrunMs = 120;  // misses the slots at 100 and 150 ms
+constexpr int kFirings   = 3;
+
+struct Firings
+{
+  Clock::time_point at[kFirings];
+  std::atomic<int>  count {0};
+};
+
+} // namespace
+
+int main()
+{
+  Firings firings;
+  Timer timer;
+  CHECK(timer.Create("overrun", [](void* arg) {
+    auto* f = static_cast<Firings*>(arg);
+    int n = f->count.load();
+    if (n < kFirings) f->at[n] = Clock::now();
+    f->count.store(n + 1);
+    if (n == 0) std::this_thread::sleep_for(std::chrono::milliseconds(kOverrunMs));
+  }, &firings, kPeriodMs, true) == OsStatus::Ok);
+
+  CHECK(timer.Start() == OsStatus::Ok);
+  while (firings.count.load() < kFirings)
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  CHECK(timer.Stop() == OsStatus::Ok);
+
+  auto gap = [&](int a, int b) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(firings.at[b] - firings.at[a]).count();
+  };
+  // Slot 50 ran until 170; the next firing is the 200 ms slot, not an
+  // immediate catch-up at 170 for the missed 100 ms slot
+  CHECK(gap(0, 1) >= 3 * kPeriodMs - 15);
+  // ...and from there the original 50 ms rhythm resumes
+  CHECK(gap(1, 2) >= kPeriodMs - 15);
+  return 0;
+}
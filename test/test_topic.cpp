@@ -0,0 +1,55 @@
+/// @file test_topic.cpp
+/// @brief Subscriber overflow policies are applied by the subscriber's
+/// MessageQueue: every rejected or evicted sample must return its pool
+/// block and show up in the subscriber's dropped count.
+
+#include "check.hpp"
+#include "osal/osal.hpp"
+
+using namespace ifce::os;
+
+static void PolicyDropsReturnBlocks(OverflowPolicy policy, int first_kept)
+{
+  Topic<int> topic;
+  CHECK(topic.Create(8) == OsStatus::Ok);
+  Topic<int>::Subscriber sub;
+  CHECK(topic.Subscribe(sub, 2, policy) == OsStatus::Ok);
+
+  for (int i = 0; i < 5; ++i)
+    CHECK(topic.Publish(i) == OsStatus::Ok);
+
+  SubscriberStats stats = sub.GetStats();
+  CHECK(stats.depth == 2);
+  CHECK(stats.dropped == 3);
+  // Only the two queued samples still hold blocks
+  CHECK(topic.GetFreeCount() == 6);
+
+  Topic<int>::Sample sample;
+  CHECK(sub.Take(sample, 0) == OsStatus::Ok && *sample == first_kept);
+  CHECK(sub.Take(sample, 0) == OsStatus::Ok && *sample == first_kept + 1);
+  sample.Reset();
+  CHECK(topic.GetFreeCount() == 8);
+}
+
+int main()
+{
+  PolicyDropsReturnBlocks(OverflowPolicy::DropNewest, 0);
+  PolicyDropsReturnBlocks(OverflowPolicy::DropOldest, 3);
+
+  // A timed-out Block-policy delivery counts as dropped too
+  Topic<int> topic;
+  CHECK(topic.Create(4) == OsStatus::Ok);
+  Topic<int>::Subscriber sub;
+  CHECK(topic.Subscribe(sub, 1, OverflowPolicy::Block) == OsStatus::Ok);
+  CHECK(topic.Publish(1, 0) == OsStatus::Ok);
+  CHECK(topic.Publish(2, 0) == OsStatus::Ok);
+  CHECK(sub.GetStats().dropped == 1);
+  CHECK(topic.GetFreeCount() == 3);
+
+  // Samples have no priority to evict by
+  Topic<int>::Subscriber lowest;
+  CHECK(topic.Subscribe(lowest, 2, OverflowPolicy::EvictLowest) == OsStatus::Error);
+
+  std::puts("test_topic: ok");
+  return 0;
+}